@@ -2,10 +2,35 @@
 
 #include "fixed_containers/memory.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace fixed_containers::algorithm
 {
+// Element types that `find_value()` and `count_value()` compare a block at a time. Wider types are
+// left to the scalar loop: 64-bit integer compares do not vectorize on baseline x86-64 (SSE2).
+template <typename T>
+concept BlockComparable = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) <= 4;
+
+namespace algorithm_detail
+{
+// One cache line per block
+template <typename T>
+inline constexpr std::size_t COMPARISON_BLOCK_SIZE = 64 / sizeof(T);
+
+// An unsigned type as wide as T, so that the per-block comparison results fill whole SIMD lanes
+template <typename T>
+using ComparisonMaskType =
+    std::conditional_t<sizeof(T) == 1,
+                       std::uint8_t,
+                       std::conditional_t<sizeof(T) == 2, std::uint16_t, std::uint32_t>>;
+}  // namespace algorithm_detail
+
 // Similar to https://en.cppreference.com/w/cpp/memory/uninitialized_move
 // but also destroys the source range
 template <class FwdIt1, class FwdIt2>
@@ -35,4 +60,90 @@ constexpr BidirIt2 uninitialized_relocate_backward(BidirIt1 first, BidirIt1 last
     }
     return d_last;
 }
+
+// Like std::remove_if, but fills every hole with the last kept element instead of shifting the
+// remaining elements down, so the order of the kept elements is not preserved. Moves at most one
+// element per removed element; std::remove_if moves every element after the first removed one.
+template <class BidirIt, class Predicate>
+constexpr BidirIt unstable_remove_if(BidirIt first, BidirIt last, Predicate predicate)
+{
+    while (true)
+    {
+        first = std::find_if(first, last, predicate);
+        if (first == last)
+        {
+            return first;
+        }
+        do
+        {
+            --last;
+            if (first == last)
+            {
+                return first;
+            }
+        } while (predicate(*last));
+
+        *first = std::move(*last);
+        ++first;
+    }
+}
+
+// Relocates [first, last) to d_first with a single memmove; the ranges may overlap.
+// Only valid for `TriviallyRelocatable` element types and outside of constant evaluation.
+template <class T>
+T* trivially_relocate(T* first, T* last, T* d_first) noexcept
+{
+    const auto count = static_cast<std::size_t>(last - first);
+    std::memmove(static_cast<void*>(d_first), static_cast<const void*>(first), count * sizeof(T));
+    return d_first + count;
+}
+
+// Like std::find over a contiguous range. Each block of values is compared without an early exit
+// and the comparison results are or-ed together, which compilers turn into SIMD compares
+// (SSE2/AVX2/NEON) without any target-specific code. Only the block with the match is then
+// scanned element by element.
+template <BlockComparable T>
+constexpr const T* find_value(const T* first, const T* const last, const T& value)
+{
+    using MaskType = algorithm_detail::ComparisonMaskType<T>;
+    constexpr std::size_t BLOCK_SIZE = algorithm_detail::COMPARISON_BLOCK_SIZE<T>;
+
+    while (static_cast<std::size_t>(std::distance(first, last)) >= BLOCK_SIZE)
+    {
+        MaskType found = 0;
+        for (std::size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            found |= static_cast<MaskType>(first[i] == value);
+        }
+        if (found != 0)
+        {
+            break;
+        }
+        first = std::next(first, static_cast<std::ptrdiff_t>(BLOCK_SIZE));
+    }
+    return std::find(first, last, value);
+}
+
+// Like std::count over a contiguous range. Matches are summed per block in a lane-wide counter,
+// see `find_value()`.
+template <BlockComparable T>
+constexpr std::size_t count_value(const T* first, const T* const last, const T& value)
+{
+    using MaskType = algorithm_detail::ComparisonMaskType<T>;
+    constexpr std::size_t BLOCK_SIZE = algorithm_detail::COMPARISON_BLOCK_SIZE<T>;
+
+    std::size_t result = 0;
+    while (static_cast<std::size_t>(std::distance(first, last)) >= BLOCK_SIZE)
+    {
+        MaskType block_count = 0;
+        for (std::size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            // Cannot overflow: a block has fewer elements than MaskType can count
+            block_count = static_cast<MaskType>(block_count + (first[i] == value));
+        }
+        result += block_count;
+        first = std::next(first, static_cast<std::ptrdiff_t>(BLOCK_SIZE));
+    }
+    return result + static_cast<std::size_t>(std::count(first, last, value));
+}
 }  // namespace fixed_containers::algorithm
@@ -4,7 +4,9 @@
 #include "fixed_containers/int_math.hpp"
 #include "fixed_containers/integer_range.hpp"
 
+#include <bit>
 #include <compare>
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 
@@ -66,4 +68,61 @@ constexpr CyclesAndInteger decrement_index_with_wraparound(const IntegerRangeTyp
     out.cycles -= static_cast<std::int64_t>(negative_cycles);
     return out;
 }
+
+// The functions below are for the common case of a [0, CAPACITY) range that is known at
+// compile-time and of callers that only need the wrapped index. They avoid the division of the
+// general versions: power-of-two capacities are masked, and other capacities use a conditional
+// subtract when the step is smaller than the capacity (division by the constant is left for
+// larger steps).
+
+// Returns `value % CAPACITY`.
+template <std::size_t CAPACITY>
+constexpr std::size_t wrap_index(const std::size_t value)
+{
+    if constexpr (CAPACITY == 0)
+    {
+        // There is nothing to index
+        return 0;
+    }
+    else if constexpr (std::has_single_bit(CAPACITY))
+    {
+        return value & (CAPACITY - 1);
+    }
+    else
+    {
+        return value % CAPACITY;
+    }
+}
+
+// Returns `(index + n) % CAPACITY`. Requires `index < CAPACITY`.
+template <std::size_t CAPACITY>
+constexpr std::size_t increment_index_with_wraparound(const std::size_t index, const std::size_t n)
+{
+    if constexpr (CAPACITY == 0 || std::has_single_bit(CAPACITY))
+    {
+        // Unsigned overflow wraps modulo a multiple of CAPACITY, so it does not affect the result
+        return wrap_index<CAPACITY>(index + n);
+    }
+    else
+    {
+        const std::size_t step = n < CAPACITY ? n : wrap_index<CAPACITY>(n);
+        const std::size_t unwrapped = index + step;
+        return unwrapped >= CAPACITY ? unwrapped - CAPACITY : unwrapped;
+    }
+}
+
+// Returns `(index - n) mod CAPACITY`, in [0, CAPACITY). Requires `index < CAPACITY`.
+template <std::size_t CAPACITY>
+constexpr std::size_t decrement_index_with_wraparound(const std::size_t index, const std::size_t n)
+{
+    if constexpr (CAPACITY == 0 || std::has_single_bit(CAPACITY))
+    {
+        return wrap_index<CAPACITY>(index - n);
+    }
+    else
+    {
+        const std::size_t step = n < CAPACITY ? n : wrap_index<CAPACITY>(n);
+        return index >= step ? index - step : index + (CAPACITY - step);
+    }
+}
 }  // namespace fixed_containers::circular_indexing
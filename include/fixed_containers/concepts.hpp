@@ -4,6 +4,17 @@
 #include <iterator>
 #include <type_traits>
 
+namespace fixed_containers::customize
+{
+// Specialize to `std::true_type` for types whose relocation (move-construct into new storage and
+// destroy the source) is equivalent to copying their bytes, e.g. types that own a heap pointer but
+// never point into themselves. Trivially copyable types are always treated that way.
+template <typename T>
+struct IsTriviallyRelocatable : std::false_type
+{
+};
+}  // namespace fixed_containers::customize
+
 // NOTE: A concept X is accompanied by NotX and should be used instead of (!X) for proper
 // subsumption. De Morgan's law also does not apply for subsumption.
 // More info: https://en.cppreference.com/w/cpp/language/constraints
@@ -100,6 +111,13 @@ concept TriviallyDestructible = std::is_trivially_destructible_v<T>;
 template <class T>
 concept NotTriviallyDestructible = not TriviallyDestructible<T>;
 
+// Containers are allowed to relocate such types with memmove instead of move+destroy
+template <class T>
+concept TriviallyRelocatable =
+    TriviallyCopyable<T> || customize::IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+template <class T>
+concept NotTriviallyRelocatable = not TriviallyRelocatable<T>;
+
 template <class T>
 concept Aggregate = std::is_aggregate_v<T>;
 template <class T>
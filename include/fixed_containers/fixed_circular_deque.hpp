@@ -1,15 +1,20 @@
 #pragma once
 
+#include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/optional_reference.hpp"
+#include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <span>
 #include <utility>
 
 namespace fixed_containers
@@ -21,6 +26,7 @@ template <typename T,
 class FixedCircularDeque
 {
     using FixedDequeStorage = FixedDeque<T, MAXIMUM_SIZE, CheckingType>;
+    using Checking = CheckingType;
 
 public:
     using value_type = typename FixedDequeStorage::value_type;
@@ -34,16 +40,23 @@ public:
     using iterator = typename FixedDequeStorage::iterator;
     using reverse_iterator = typename FixedDequeStorage::reverse_iterator;
     using const_reverse_iterator = typename FixedDequeStorage::const_reverse_iterator;
+    using sequence_type = std::uint64_t;
 
 public:
     [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     FixedDequeStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    sequence_type IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_;
+    sequence_type IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_;
 
 public:
     constexpr FixedCircularDeque() noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_{0}
     {
     }
 
@@ -52,6 +65,9 @@ public:
                                  const std_transition::source_location& loc =
                                      std_transition::source_location::current()) noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{(std::min)(count, MAXIMUM_SIZE), value, loc}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_{excess_count_of(count)}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_{count}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_{0}
     {
     }
 
@@ -83,14 +99,18 @@ public:
         size_type count,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const std::size_t old_size = size();
         deque().resize(count, loc);
+        on_resize(old_size);
     }
     constexpr void resize(
         size_type count,
         const value_type& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const std::size_t old_size = size();
         deque().resize(count, value, loc);
+        on_resize(old_size);
     }
 
     constexpr void push_back(
@@ -99,6 +119,7 @@ public:
     {
         pop_front_if_full(loc);
         deque().push_back(value, loc);
+        on_push_back(1);
     }
     constexpr void push_back(
         value_type&& value,
@@ -106,19 +127,23 @@ public:
     {
         pop_front_if_full(loc);
         deque().push_back(std::move(value), loc);
+        on_push_back(1);
     }
 
     template <class... Args>
     constexpr reference emplace_back(Args&&... args)
     {
         pop_front_if_full(std_transition::source_location::current());
-        return deque().emplace_back(std::forward<Args>(args)...);
+        reference result = deque().emplace_back(std::forward<Args>(args)...);
+        on_push_back(1);
+        return result;
     }
 
     constexpr void pop_back(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         deque().pop_back(loc);
+        on_pop_back();
     }
 
     constexpr void push_front(
@@ -127,6 +152,7 @@ public:
     {
         pop_back_if_full(loc);
         deque().push_front(value, loc);
+        renumber_from(0);
     }
     constexpr void push_front(
         value_type&& value,
@@ -134,19 +160,54 @@ public:
     {
         pop_back_if_full(loc);
         deque().push_front(std::move(value), loc);
+        renumber_from(0);
     }
 
     template <class... Args>
     constexpr reference emplace_front(Args&&... args)
     {
         pop_back_if_full(std_transition::source_location::current());
-        return deque().emplace_front(std::forward<Args>(args)...);
+        reference result = deque().emplace_front(std::forward<Args>(args)...);
+        renumber_from(0);
+        return result;
     }
 
     constexpr void pop_front(
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         deque().pop_front(loc);
+        on_pop_front(1);
+    }
+
+    /**
+     * Appends copies of all of `values` at the back, overwriting the oldest elements at the front
+     * as needed. If `values` has more than `max_size()` entries, only the last ones are kept.
+     */
+    constexpr void push_back_n(
+        std::span<const T> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t pushed_count = values.size();
+        if (values.size() >= MAXIMUM_SIZE)
+        {
+            clear();
+            values = values.last(MAXIMUM_SIZE);
+        }
+        else if (const std::size_t free_count = MAXIMUM_SIZE - size(); values.size() > free_count)
+        {
+            pop_front_n(values.size() - free_count, loc);
+        }
+        deque().push_back_n(values, loc);
+        // The values that did not fit count as pushed and overwritten right away
+        on_push_back(pushed_count);
+    }
+
+    constexpr void pop_front_n(
+        const std::size_t n,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        deque().pop_front_n(n, loc);
+        on_pop_front(n);
     }
 
     constexpr iterator insert(
@@ -154,16 +215,18 @@ public:
         const value_type& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const bool inserting_at_end = pos == cend();
         pop_front_if_full(loc);
-        return deque().insert(pos, value, loc);
+        return on_insert(deque().insert(pos, value, loc), 1, inserting_at_end);
     }
     constexpr iterator insert(
         const_iterator pos,
         value_type&& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        const bool inserting_at_end = pos == cend();
         pop_front_if_full(loc);
-        return deque().insert(pos, std::move(value), loc);
+        return on_insert(deque().insert(pos, std::move(value), loc), 1, inserting_at_end);
     }
     template <InputIterator InputIt>
     constexpr iterator insert(
@@ -187,8 +250,10 @@ public:
     template <class... Args>
     constexpr iterator emplace(const_iterator pos, Args&&... args)
     {
+        const bool inserting_at_end = pos == cend();
         pop_front_if_full(std_transition::source_location::current());
-        return deque().emplace(pos, std::forward<Args>(args)...);
+        return on_insert(
+            deque().emplace(pos, std::forward<Args>(args)...), 1, inserting_at_end);
     }
 
     constexpr void assign(
@@ -196,7 +261,9 @@ public:
         const value_type& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
+        clear();
         deque().assign((std::min)(count, MAXIMUM_SIZE), value, loc);
+        on_push_back(count);
     }
 
     template <InputIterator InputIt>
@@ -212,7 +279,9 @@ public:
                 (std::max)(static_cast<std::ptrdiff_t>(0),
                            incoming_entry_count - static_cast<std::ptrdiff_t>(MAXIMUM_SIZE));
             std::advance(first, excess_max_entry_count);
+            clear();
             deque().assign(first, last, loc);
+            on_push_back(static_cast<std::size_t>(incoming_entry_count));
         }
         else  // std::input_iterator
         {
@@ -236,16 +305,27 @@ public:
                              const std_transition::source_location& loc =
                                  std_transition::source_location::current()) noexcept
     {
-        return deque().erase(first, last, loc);
+        const auto erased_count = static_cast<std::size_t>(std::distance(first, last));
+        const bool erasing_at_end = last == cend();
+        const iterator result = deque().erase(first, last, loc);
+        on_erase(static_cast<std::size_t>(std::distance(begin(), result)),
+                 erased_count,
+                 erasing_at_end);
+        return result;
     }
     constexpr iterator erase(const_iterator pos,
                              const std_transition::source_location& loc =
                                  std_transition::source_location::current()) noexcept
     {
-        return deque().erase(pos, loc);
+        return erase(pos, std::next(pos), loc);
     }
 
-    constexpr void clear() noexcept { deque().clear(); }
+    constexpr void clear() noexcept
+    {
+        deque().clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = 0;
+        normalize_sequences();
+    }
 
     constexpr iterator begin() noexcept { return deque().begin(); }
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
@@ -271,6 +351,78 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return deque().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
 
+    /**
+     * Returns the elements as (at most) two contiguous spans, see `FixedDeque::as_spans()`.
+     */
+    constexpr std::array<std::span<T>, 2> as_spans() noexcept { return deque().as_spans(); }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        return deque().as_spans();
+    }
+    /**
+     * Makes the elements contiguous in place, see `FixedDeque::linearize()`.
+     */
+    constexpr std::span<T> linearize() { return deque().linearize(); }
+
+    /**
+     * Every element added at the back gets the next number of a counter that only ever
+     * increases, see `next_sequence()`. Removing elements from the front, including overwriting
+     * the oldest ones when full, `clear()` and `erase()` at the front, advances
+     * `front_sequence()`, so readers can track their own cursor into one shared deque: the
+     * elements they missed are the ones from their cursor up to `front_sequence()`. Removing
+     * elements from the back or the middle leaves a gap; a popped sequence number is never handed
+     * out again. Only one gap is kept: adding elements anywhere but the back, or removing elements
+     * in a way that would need a second gap, gives the elements after that position new sequence
+     * numbers.
+     */
+    [[nodiscard]] constexpr sequence_type front_sequence() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_;
+    }
+    /**
+     * The sequence number the next element added with `push_back()` will have.
+     */
+    [[nodiscard]] constexpr sequence_type next_sequence() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_;
+    }
+    /**
+     * Whether the element with the given sequence number is still held.
+     */
+    [[nodiscard]] constexpr bool contains_sequence(const sequence_type sequence) const noexcept
+    {
+        return offset_of_sequence(sequence) != size();
+    }
+    /**
+     * Returns the element with the given sequence number, or an empty reference if it has already
+     * been overwritten or removed. The sequence number must be less than `next_sequence()`.
+     */
+    constexpr OptionalReference<T> at_sequence(
+        const sequence_type sequence,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_sequence(sequence, loc);
+        const std::size_t offset = offset_of_sequence(sequence);
+        if (offset == size())
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<T>{deque().at(offset, loc)};
+    }
+    [[nodiscard]] constexpr OptionalReference<const T> at_sequence(
+        const sequence_type sequence,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_sequence(sequence, loc);
+        const std::size_t offset = offset_of_sequence(sequence);
+        if (offset == size())
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<const T>{deque().at(offset, loc)};
+    }
+
     template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
     constexpr bool operator==(
         const FixedCircularDeque<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
@@ -343,6 +495,7 @@ private:
                                        InputIt last,
                                        const std_transition::source_location& loc)
     {
+        const bool inserting_at_end = pos == cend();
         const std::ptrdiff_t incoming_entry_count = std::distance(first, last);
         const auto available_entry_count = static_cast<std::ptrdiff_t>(max_size() - size());
         const auto excess_entry_count = (std::max)(static_cast<std::ptrdiff_t>(0),
@@ -359,7 +512,7 @@ private:
                 (std::min)(excess_entry_count, std::distance(deq.cbegin(), pos));
             for (std::ptrdiff_t i = 0; i < existing_elements_to_be_dropped; i++)
             {
-                deq.pop_front(loc);
+                pop_front(loc);
             }
 
             // 2) Drop incoming elements
@@ -367,9 +520,15 @@ private:
                 (std::max)(static_cast<std::ptrdiff_t>(0),
                            excess_entry_count - existing_elements_to_be_dropped);
             std::advance(first, incoming_elements_to_be_dropped);
+            // At the end, this is the same as pushing them and overwriting them right away
+            if (inserting_at_end)
+            {
+                on_push_back(static_cast<std::size_t>(incoming_elements_to_be_dropped));
+            }
         }
 
-        return deq.insert(pos, first, last, loc);
+        const auto inserted_count = static_cast<std::size_t>(std::distance(first, last));
+        return on_insert(deq.insert(pos, first, last, loc), inserted_count, inserting_at_end);
     }
 
     template <InputIterator InputIt>
@@ -412,10 +571,11 @@ private:
                 {
                     increment_first_it();
                 }
-                deq.pop_front(loc);
+                pop_front(loc);
             }
 
             deq.push_back(*first, loc);
+            on_push_back(1);
         }
 
         // If there are still more elements when we reach the barrier, overwrite the just-inserted
@@ -441,6 +601,10 @@ private:
         // Rotate into the correct places
         std::rotate(first_it, middle_it, end());
 
+        if (!inserting_at_end)
+        {
+            renumber_from(static_cast<std::size_t>(std::distance(begin(), first_it)));
+        }
         return first_it;
     }
 
@@ -460,18 +624,159 @@ private:
     {
         if (is_full(deque()))
         {
-            deque().pop_back(loc);
+            pop_back(loc);
         }
     }
     constexpr void pop_front_if_full(const std_transition::source_location& loc)
     {
         if (is_full(deque()))
         {
-            deque().pop_front(loc);
+            pop_front(loc);
         }
     }
 
     [[nodiscard]] constexpr std::size_t available_entries() const { return max_size() - size(); }
+
+    // The number of elements out of `count` that do not fit, and thus count as overwritten
+    [[nodiscard]] static constexpr sequence_type excess_count_of(const std::size_t count)
+    {
+        return count > MAXIMUM_SIZE ? count - MAXIMUM_SIZE : 0;
+    }
+
+    constexpr void check_sequence(const sequence_type sequence,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(sequence < next_sequence()))
+        {
+            Checking::invalid_argument("sequence number has not been reached yet", loc);
+        }
+    }
+
+    // The elements are numbered in (at most) two runs: the first `front_run_size()` elements
+    // from `front_sequence()` onwards, and the rest up to `next_sequence()`, exclusive. The first
+    // run is empty unless elements were removed from the back or the middle, and is merged into
+    // the second one as soon as there is no gap between them.
+    [[nodiscard]] constexpr std::size_t front_run_size() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_;
+    }
+    // Returns `size()` if the element is not held.
+    [[nodiscard]] constexpr std::size_t offset_of_sequence(const sequence_type sequence) const
+    {
+        if (sequence >= front_sequence() && sequence - front_sequence() < front_run_size())
+        {
+            return static_cast<std::size_t>(sequence - front_sequence());
+        }
+        const std::size_t back_run_size = size() - front_run_size();
+        if (sequence < next_sequence() && next_sequence() - sequence <= back_run_size)
+        {
+            return size() - static_cast<std::size_t>(next_sequence() - sequence);
+        }
+        return size();
+    }
+
+    constexpr void normalize_sequences()
+    {
+        if (front_run_size() == 0 || front_sequence() + size() == next_sequence())
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = 0;
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_ = next_sequence() - size();
+        }
+    }
+    // The following are invoked after the elements have been added or removed
+    constexpr void on_push_back(const std::size_t n)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_ += n;
+        normalize_sequences();
+    }
+    constexpr void on_pop_front(const std::size_t n)
+    {
+        if (n < front_run_size())
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ -= n;
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_sequence_ += n;
+        }
+        else
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = 0;
+        }
+        normalize_sequences();
+    }
+    constexpr void on_pop_back()
+    {
+        if (front_run_size() == 0 || front_run_size() >= size())
+        {
+            // Everything that is left is numbered from the front, up to the gap
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = size();
+            normalize_sequences();
+            return;
+        }
+        // A second gap cannot be represented, so what is left of the back run is renumbered
+        renumber_from(front_run_size());
+    }
+    constexpr void on_resize(const std::size_t old_size)
+    {
+        if (size() > old_size)
+        {
+            on_push_back(size() - old_size);
+        }
+        else if (size() < old_size)
+        {
+            on_pop_back();
+        }
+    }
+    constexpr iterator on_insert(const iterator result,
+                                 const std::size_t inserted_count,
+                                 const bool inserting_at_end)
+    {
+        if (inserting_at_end)
+        {
+            on_push_back(inserted_count);
+        }
+        else
+        {
+            renumber_from(static_cast<std::size_t>(std::distance(begin(), result)));
+        }
+        return result;
+    }
+    constexpr void on_erase(const std::size_t offset,
+                            const std::size_t erased_count,
+                            const bool erasing_at_end)
+    {
+        if (erased_count == 0)
+        {
+            return;
+        }
+        if (offset == 0)
+        {
+            on_pop_front(erased_count);
+        }
+        else if (erasing_at_end)
+        {
+            on_pop_back();
+        }
+        else if (front_run_size() == 0 ||
+                 (offset <= front_run_size() && front_run_size() <= offset + erased_count))
+        {
+            // The gap lines up with the existing one, if any
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = offset;
+            normalize_sequences();
+        }
+        else
+        {
+            renumber_from(offset);
+        }
+    }
+    // Keeps the sequence numbers of the elements before `offset` (if they are in the first run)
+    // and hands out new ones to all elements after it.
+    constexpr void renumber_from(const std::size_t offset)
+    {
+        const std::size_t kept_count =
+            front_run_size() == 0 ? offset : (std::min)(offset, front_run_size());
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_front_run_size_ = kept_count;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_sequence_ += size() - kept_count;
+        normalize_sequences();
+    }
 };
 
 template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
@@ -499,6 +804,16 @@ constexpr typename FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>::size_type
     return original_size - container.size();
 }
 
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
+constexpr typename FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>::size_type erase_unordered_if(
+    FixedCircularDeque<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    const auto original_size = container.size();
+    container.erase(algorithm::unstable_remove_if(container.begin(), container.end(), predicate),
+                    container.end());
+    return original_size - container.size();
+}
+
 /**
  * Construct a FixedCircularDeque with its capacity being deduced from the number of items being
  * passed.
@@ -4,6 +4,7 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/circular_indexing.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/int_math.hpp"
 #include "fixed_containers/integer_range.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/memory.hpp"
@@ -16,11 +17,14 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <span>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_deque_detail
 {
@@ -40,21 +44,30 @@ class FixedDequeBase
                   "Deque must have a non-const, non-volatile value_type");
     using Checking = CheckingType;
     using Array = std::array<OptionalT, MAXIMUM_SIZE>;
-    static constexpr StartingIntegerAndDistance FULL_STARTING_INDEX_AND_SIZE{
-        .start = 0, .distance = MAXIMUM_SIZE};
-    static constexpr IntegerRange FULL_RANGE = FULL_STARTING_INDEX_AND_SIZE.to_range();
     static constexpr std::size_t STARTING_OFFSET =
         (std::numeric_limits<std::size_t>::max)() / static_cast<std::size_t>(2);
+    // `-STARTING_OFFSET` modulo MAXIMUM_SIZE
+    static constexpr std::size_t STARTING_OFFSET_COMPLEMENT =
+        circular_indexing::decrement_index_with_wraparound<MAXIMUM_SIZE>(0, STARTING_OFFSET);
 
+    // Both require an index into the array, i.e. `index < MAXIMUM_SIZE`
     static constexpr std::size_t increment_index_with_wraparound(std::size_t index,
                                                                  std::size_t n = 1)
     {
-        return circular_indexing::increment_index_with_wraparound(FULL_RANGE, index, n).integer;
+        return circular_indexing::increment_index_with_wraparound<MAXIMUM_SIZE>(index, n);
     }
     static constexpr std::size_t decrement_index_with_wraparound(std::size_t index,
                                                                  std::size_t n = 1)
     {
-        return circular_indexing::decrement_index_with_wraparound(FULL_RANGE, index, n).integer;
+        return circular_indexing::decrement_index_with_wraparound<MAXIMUM_SIZE>(index, n);
+    }
+    // Maps the never-wrapping index that is stored in the iterators and as the starting index
+    // to an index into the array. That index stays close to STARTING_OFFSET, so adding the
+    // complement cannot overflow and a single wrap suffices.
+    static constexpr std::size_t array_index_of(const std::size_t unwrapped_index)
+    {
+        return circular_indexing::wrap_index<MAXIMUM_SIZE>(unwrapped_index +
+                                                           STARTING_OFFSET_COMPLEMENT);
     }
 
 public:
@@ -71,25 +84,22 @@ private:
     class ReferenceProvider
     {
         friend class ReferenceProvider<!IS_CONST>;
-        using ConstOrMutableArray = std::conditional_t<IS_CONST, const Array, Array>;
+        using ConstOrMutableDeque =
+            std::conditional_t<IS_CONST, const FixedDequeBase, FixedDequeBase>;
 
     private:
-        ConstOrMutableArray* array_;
-        const StartingIntegerAndDistance* starting_index_and_distance_;
+        ConstOrMutableDeque* deque_;
         std::size_t current_index_;
 
     public:
         constexpr ReferenceProvider() noexcept
-          : ReferenceProvider{nullptr, std::addressof(FULL_STARTING_INDEX_AND_SIZE), 0}
+          : ReferenceProvider{nullptr, 0}
         {
         }
 
-        constexpr ReferenceProvider(
-            ConstOrMutableArray* const array,
-            const StartingIntegerAndDistance* const starting_index_and_distance,
-            const std::size_t& current_index) noexcept
-          : array_{array}
-          , starting_index_and_distance_{starting_index_and_distance}
+        constexpr ReferenceProvider(ConstOrMutableDeque* const deque,
+                                    const std::size_t& current_index) noexcept
+          : deque_{deque}
           , current_index_{current_index}
         {
         }
@@ -98,9 +108,7 @@ private:
         template <bool IS_CONST_2>
         constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& mutable_other) noexcept
             requires(IS_CONST and !IS_CONST_2)
-          : ReferenceProvider{mutable_other.array_,
-                              mutable_other.starting_index_and_distance_,
-                              mutable_other.current_index_}
+          : ReferenceProvider{mutable_other.deque_, mutable_other.current_index_}
         {
         }
 
@@ -110,32 +118,28 @@ private:
         [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
             const noexcept
         {
-            assert_or_abort(starting_index_and_distance_->to_range().contains(current_index_));
-            const std::size_t index =
-                decrement_index_with_wraparound(current_index_, STARTING_OFFSET);
-            return optional_storage_detail::get(array_->at(index));
+            assert_or_abort(deque_->starting_index_and_size().to_range().contains(current_index_));
+            const std::size_t index = array_index_of(current_index_);
+            return optional_storage_detail::get(deque_->array().at(index));
         }
 
         template <bool IS_CONST2>
         constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
         {
-            assert_or_abort(array_ == other.array_);
-            assert_or_abort(starting_index_and_distance_ == other.starting_index_and_distance_);
+            assert_or_abort(deque_ == other.deque_);
             return current_index_ == other.current_index_;
         }
         template <bool IS_CONST2>
         constexpr auto operator<=>(const ReferenceProvider<IS_CONST2>& other) const noexcept
         {
-            assert_or_abort(array_ == other.array_);
-            assert_or_abort(starting_index_and_distance_ == other.starting_index_and_distance_);
+            assert_or_abort(deque_ == other.deque_);
             return current_index_ <=> other.current_index_;
         }
 
         template <bool IS_CONST2>
         constexpr std::ptrdiff_t operator-(const ReferenceProvider<IS_CONST2>& other) const
         {
-            assert_or_abort(array_ == other.array_);
-            assert_or_abort(starting_index_and_distance_ == other.starting_index_and_distance_);
+            assert_or_abort(deque_ == other.deque_);
             return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
         }
     };
@@ -168,14 +172,20 @@ private:
         }
     }
 
+    // The size is stored in the narrowest type that can hold MAXIMUM_SIZE, right after the array
+    // so it can share its tail padding. The starting index stays a `std::size_t`: it is not
+    // wrapped around, so that iterators stay consistent when it changes (see STARTING_OFFSET).
+    using SizeStorageType = int_math::SmallestUnsignedIntegralFor<MAXIMUM_SIZE>;
+
 public:
     Array IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
-    StartingIntegerAndDistance IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_;
+    SizeStorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_;
 
 public:
     constexpr FixedDequeBase() noexcept
-      : IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_{.start = STARTING_OFFSET,
-                                                                  .distance = 0}
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_{STARTING_OFFSET}
     // Don't initialize the array
     {
     }
@@ -315,13 +325,67 @@ public:
         decrement_size();
     }
 
+    /**
+     * Appends copies of all of `values` at the back. Trivially copyable types are copied with (at
+     * most) two memcpy calls, one per contiguous run of free storage.
+     */
+    constexpr void push_back_n(
+        const std::span<const T> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(size() + values.size(), loc);
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (!std::is_constant_evaluated() && !values.empty())
+            {
+                const std::size_t first_index = end_index();
+                const std::size_t first_count =
+                    (std::min)(values.size(), MAXIMUM_SIZE - first_index);
+                std::memcpy(std::addressof(unchecked_at(first_index)),
+                            values.data(),
+                            first_count * sizeof(T));
+                std::memcpy(std::addressof(unchecked_at(0)),
+                            std::next(values.data(), static_cast<difference_type>(first_count)),
+                            (values.size() - first_count) * sizeof(T));
+                increment_size(values.size());
+                return;
+            }
+        }
+        for (const T& value : values)
+        {
+            push_back_internal(value);
+        }
+    }
+
+    /**
+     * Removes the first `n` elements.
+     */
+    constexpr void pop_front_n(
+        const std::size_t n,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(n <= size()))
+        {
+            Checking::out_of_range(n, size(), loc);
+        }
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                destroy_at(increment_index_with_wraparound(front_index(), i));
+            }
+        }
+        increment_start(n);
+        decrement_size(n);
+    }
+
     constexpr iterator insert(
         const_iterator pos,
         const value_type& value,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         check_not_full(loc);
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, value);
         return entry_it;
     }
@@ -331,7 +395,7 @@ public:
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
         check_not_full(loc);
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, std::move(value));
         return entry_it;
     }
@@ -358,7 +422,7 @@ public:
     constexpr iterator emplace(const_iterator pos, Args&&... args)
     {
         check_not_full(std_transition::source_location::current());
-        auto entry_it = advance_all_after_iterator_by_n(pos, 1);
+        auto entry_it = open_gap_at(pos, 1);
         memory::construct_at_address_of(*entry_it, std::forward<Args>(args)...);
         return entry_it;
     }
@@ -404,13 +468,17 @@ public:
         {
             Checking::invalid_argument("iterators exceed container range", loc);
         }
+        if (first == last)
+        {
+            return const_to_mutable_it(first);
+        }
 
-        const auto entry_count_to_move = std::distance(last, cend());
-        const auto entry_count_to_remove = std::distance(first, last);
-
-        const iterator read_start_it = const_to_mutable_it(last);
-        const iterator read_end_it = std::next(read_start_it, entry_count_to_move);
-        iterator write_start_it = const_to_mutable_it(first);
+        // Like std::deque, close the gap by moving whichever side of it has fewer elements
+        const auto entry_count_to_remove = static_cast<std::size_t>(std::distance(first, last));
+        const std::size_t entry_count_before = index_of(first);
+        const std::size_t entry_count_after = size() - index_of(last);
+        const iterator gap_start_it = const_to_mutable_it(first);
+        const iterator gap_end_it = const_to_mutable_it(last);
 
         if (!std::is_constant_evaluated())
         {
@@ -418,22 +486,55 @@ public:
             // complains about objects being accessed outside their lifetimes.
 
             // Clean out the gap
-            destroy_range(write_start_it, std::next(write_start_it, entry_count_to_remove));
+            destroy_range(gap_start_it, gap_end_it);
 
             // Do the relocation
-            algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            if (entry_count_before < entry_count_after)
+            {
+                if constexpr (TriviallyRelocatable<T>)
+                {
+                    trivially_relocate_entries(0, entry_count_to_remove, entry_count_before);
+                }
+                else
+                {
+                    algorithm::uninitialized_relocate_backward(begin(), gap_start_it, gap_end_it);
+                }
+            }
+            else
+            {
+                if constexpr (TriviallyRelocatable<T>)
+                {
+                    trivially_relocate_entries(
+                        index_of(last), index_of(first), entry_count_after);
+                }
+                else
+                {
+                    algorithm::uninitialized_relocate(gap_end_it, end(), gap_start_it);
+                }
+            }
         }
         else
         {
-            // Do the move
-            const iterator write_end_it = std::move(read_start_it, read_end_it, write_start_it);
-
-            // Clean out the tail
-            destroy_range(write_end_it, read_end_it);
+            // Do the move, and then clean out the entries that were moved from
+            if (entry_count_before < entry_count_after)
+            {
+                const iterator write_start_it =
+                    std::move_backward(begin(), gap_start_it, gap_end_it);
+                destroy_range(begin(), write_start_it);
+            }
+            else
+            {
+                const iterator write_end_it = std::move(gap_end_it, end(), gap_start_it);
+                destroy_range(write_end_it, end());
+            }
         }
 
-        decrement_size(static_cast<std::size_t>(entry_count_to_remove));
-        return write_start_it;
+        if (entry_count_before < entry_count_after)
+        {
+            increment_start(entry_count_to_remove);
+        }
+        decrement_size(entry_count_to_remove);
+        return create_iterator(starting_index_and_size().start + entry_count_before);
     }
     constexpr iterator erase(const_iterator pos,
                              const std_transition::source_location& loc =
@@ -487,7 +588,7 @@ public:
     [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
     [[nodiscard]] constexpr std::size_t size() const noexcept
     {
-        return starting_index_and_size().distance;
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
     }
     [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
 
@@ -576,7 +677,142 @@ public:
         return unchecked_at(back_index());
     }
 
+    /**
+     * Returns an iterator to the first element equal to `value`, or `end()`.
+     * For arithmetic and enum types, each of the (at most two) contiguous segments of the
+     * circular storage is compared a block at a time, which compilers vectorize.
+     */
+    constexpr iterator find(const T& value)
+    {
+        return const_to_mutable_it(std::as_const(*this).find(value));
+    }
+    [[nodiscard]] constexpr const_iterator find(const T& value) const
+    {
+        if constexpr (algorithm::BlockComparable<T>)
+        {
+            if (!std::is_constant_evaluated() && !empty())
+            {
+                std::size_t offset = 0;
+                for (const std::span<const T> segment : as_spans())
+                {
+                    const T* const segment_last = std::to_address(segment.end());
+                    const T* const found =
+                        algorithm::find_value(segment.data(), segment_last, value);
+                    offset += static_cast<std::size_t>(std::distance(segment.data(), found));
+                    if (found != segment_last)
+                    {
+                        break;
+                    }
+                }
+                return create_const_iterator(starting_index_and_size().start + offset);
+            }
+        }
+        return std::find(cbegin(), cend(), value);
+    }
+
+    /**
+     * Returns the number of elements equal to `value`, see `find()`.
+     */
+    [[nodiscard]] constexpr size_type count(const T& value) const
+    {
+        if constexpr (algorithm::BlockComparable<T>)
+        {
+            if (!std::is_constant_evaluated() && !empty())
+            {
+                std::size_t result = 0;
+                for (const std::span<const T> segment : as_spans())
+                {
+                    result += algorithm::count_value(
+                        segment.data(), std::to_address(segment.end()), value);
+                }
+                return result;
+            }
+        }
+        return static_cast<size_type>(std::count(cbegin(), cend(), value));
+    }
+
+    /**
+     * Checks whether there is an element equal to `value`, see `find()`.
+     */
+    [[nodiscard]] constexpr bool contains(const T& value) const { return find(value) != cend(); }
+
+    /**
+     * Returns the elements as (at most) two contiguous spans, in order: from the front to the end
+     * of the underlying array, and then from the beginning of the array. The second span is empty
+     * unless the elements wrap around the end of the array, see `linearize()`.
+     * Meant for bulk consumers such as memcpy, writev or vectorized loops. Elements beyond the
+     * first one of each span cannot be accessed during constant evaluation.
+     */
+    constexpr std::array<std::span<T>, 2> as_spans() noexcept
+    {
+        const auto [first_segment_size, second_segment_size] = segment_sizes();
+        return {span_at(front_index(), first_segment_size), span_at(0, second_segment_size)};
+    }
+    [[nodiscard]] constexpr std::array<std::span<const T>, 2> as_spans() const noexcept
+    {
+        const auto [first_segment_size, second_segment_size] = segment_sizes();
+        return {span_at(front_index(), first_segment_size), span_at(0, second_segment_size)};
+    }
+
+    /**
+     * Moves the elements in place so that they start at the beginning of the underlying array,
+     * and returns them as a single contiguous span. Invalidates all iterators.
+     */
+    constexpr std::span<T> linearize()
+    {
+        const std::size_t front = front_index();
+        const auto [first_segment_size, second_segment_size] = segment_sizes();
+        if (second_segment_size != 0)
+        {
+            // Move the first segment right after the second one, so that [0, size()) holds all
+            // the elements, and then rotate the first segment into the front
+            relocate_run(front, second_segment_size, first_segment_size);
+            rotate_run_to_front(second_segment_size, size());
+        }
+        else if (front != 0)
+        {
+            relocate_run(front, 0, first_segment_size);
+        }
+        set_start(STARTING_OFFSET);  // Maps to index 0 of the array
+        return span_at(0, size());
+    }
+
 private:
+    // Makes room for `n` entries in front of `pos`, by moving whichever side of it has fewer
+    // elements, and returns an iterator to the (unconstructed) first entry of the gap
+    constexpr iterator open_gap_at(const const_iterator pos, const std::size_t n)
+    {
+        const std::size_t value_count_before = index_of(pos);
+        if (value_count_before < size() - value_count_before)
+        {
+            return recede_all_before_iterator_by_n(pos, n);
+        }
+        return advance_all_after_iterator_by_n(pos, n);
+    }
+
+    constexpr iterator recede_all_before_iterator_by_n(const const_iterator pos,
+                                                       const std::size_t n)
+    {
+        const std::size_t value_count_to_move = index_of(pos);
+        decrement_start(n);  // Decrement now so iterators are all within valid range
+        increment_size(n);
+
+        auto write_start_it = begin();
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                trivially_relocate_entries(n, 0, value_count_to_move);
+                return std::next(write_start_it, static_cast<std::ptrdiff_t>(value_count_to_move));
+            }
+        }
+
+        auto read_start_it = std::next(write_start_it, static_cast<std::ptrdiff_t>(n));
+        auto read_end_it =
+            std::next(read_start_it, static_cast<std::ptrdiff_t>(value_count_to_move));
+        return algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+    }
+
     constexpr iterator advance_all_after_iterator_by_n(const const_iterator pos,
                                                        const std::size_t n)
     {
@@ -584,6 +820,18 @@ private:
         increment_size(n);  // Increment now so iterators are all within valid range
 
         auto read_start_it = const_to_mutable_it(pos);
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t read_start_index = index_of(pos);
+                trivially_relocate_entries(read_start_index,
+                                           read_start_index + n,
+                                           static_cast<std::size_t>(value_count_to_move));
+                return read_start_it;
+            }
+        }
+
         auto read_end_it = std::next(read_start_it, value_count_to_move);
         auto write_end_it =
             std::next(read_start_it, static_cast<std::ptrdiff_t>(n) + value_count_to_move);
@@ -592,6 +840,54 @@ private:
         return read_start_it;
     }
 
+    // Relocates `count` entries from `from_offset` to `to_offset` (both relative to the front),
+    // with one memmove per physically contiguous chunk. Only usable outside of constant
+    // evaluation.
+    void trivially_relocate_entries(const std::size_t from_offset,
+                                    const std::size_t to_offset,
+                                    const std::size_t count) noexcept
+    {
+        OptionalT* const entries = array().data();
+        const auto relocate_chunk =
+            [entries](const std::size_t from, const std::size_t to, const std::size_t chunk)
+        {
+            OptionalT* const first = std::next(entries, static_cast<difference_type>(from));
+            algorithm::trivially_relocate(first,
+                                          std::next(first, static_cast<difference_type>(chunk)),
+                                          std::next(entries, static_cast<difference_type>(to)));
+        };
+
+        if (to_offset < from_offset)
+        {
+            // Front to back, so that every source is read before it gets overwritten
+            for (std::size_t done = 0; done < count;)
+            {
+                const std::size_t from =
+                    increment_index_with_wraparound(front_index(), from_offset + done);
+                const std::size_t to =
+                    increment_index_with_wraparound(front_index(), to_offset + done);
+                const std::size_t chunk =
+                    (std::min)({count - done, MAXIMUM_SIZE - from, MAXIMUM_SIZE - to});
+                relocate_chunk(from, to, chunk);
+                done += chunk;
+            }
+        }
+        else
+        {
+            for (std::size_t remaining = count; remaining > 0;)
+            {
+                const std::size_t from_end =
+                    increment_index_with_wraparound(front_index(), from_offset + remaining - 1) +
+                    1;
+                const std::size_t to_end =
+                    increment_index_with_wraparound(front_index(), to_offset + remaining - 1) + 1;
+                const std::size_t chunk = (std::min)({remaining, from_end, to_end});
+                relocate_chunk(from_end - chunk, to_end - chunk, chunk);
+                remaining -= chunk;
+            }
+        }
+    }
+
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
                                        const_iterator pos,
@@ -602,7 +898,7 @@ private:
         const auto entry_count_to_add = static_cast<std::size_t>(std::distance(first, last));
         check_target_size(size() + entry_count_to_add, loc);
 
-        auto write_it = advance_all_after_iterator_by_n(pos, entry_count_to_add);
+        auto write_it = open_gap_at(pos, entry_count_to_add);
         for (auto w_it = write_it; first != last; std::advance(first, 1), std::advance(w_it, 1))
         {
             memory::construct_at_address_of(*w_it, *first);
@@ -645,27 +941,23 @@ private:
 
     constexpr iterator create_iterator(const std::size_t offset_from_start) noexcept
     {
-        return iterator{ReferenceProvider<false>{
-            std::addressof(array()), std::addressof(starting_index_and_size()), offset_from_start}};
+        return iterator{ReferenceProvider<false>{this, offset_from_start}};
     }
     [[nodiscard]] constexpr const_iterator create_const_iterator(
         const std::size_t offset_from_start) const noexcept
     {
-        return const_iterator{ReferenceProvider<true>{
-            std::addressof(array()), std::addressof(starting_index_and_size()), offset_from_start}};
+        return const_iterator{ReferenceProvider<true>{this, offset_from_start}};
     }
 
     constexpr reverse_iterator create_reverse_iterator(const std::size_t offset_from_start) noexcept
     {
-        return reverse_iterator{ReferenceProvider<false>{
-            std::addressof(array()), std::addressof(starting_index_and_size()), offset_from_start}};
+        return reverse_iterator{ReferenceProvider<false>{this, offset_from_start}};
     }
 
     [[nodiscard]] constexpr const_reverse_iterator create_const_reverse_iterator(
         const std::size_t offset_from_start) const noexcept
     {
-        return const_reverse_iterator{ReferenceProvider<true>{
-            std::addressof(array()), std::addressof(starting_index_and_size()), offset_from_start}};
+        return const_reverse_iterator{ReferenceProvider<true>{this, offset_from_start}};
     }
 
 private:
@@ -673,6 +965,10 @@ private:
     {
         return std::next(begin(), std::distance(cbegin(), pos));
     }
+    [[nodiscard]] constexpr std::size_t index_of(const_iterator pos) const
+    {
+        return static_cast<std::size_t>(std::distance(cbegin(), pos));
+    }
 
     constexpr void check_not_full(const std_transition::source_location& loc) const
     {
@@ -689,9 +985,83 @@ private:
         }
     }
 
+    // The sizes of the runs of elements from the front to the end of the array, and from the
+    // beginning of the array, see `as_spans()`.
+    [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> segment_sizes() const
+    {
+        const std::size_t first_segment_size = (std::min)(size(), MAXIMUM_SIZE - front_index());
+        return {first_segment_size, size() - first_segment_size};
+    }
+    [[nodiscard]] constexpr std::span<const T> span_at(const std::size_t index,
+                                                       const std::size_t count) const
+    {
+        static_assert(sizeof(OptionalT) == sizeof(T));
+        if (count == 0)
+        {
+            return {};
+        }
+        return {std::addressof(unchecked_at(index)), count};
+    }
+    constexpr std::span<T> span_at(const std::size_t index, const std::size_t count)
+    {
+        static_assert(sizeof(OptionalT) == sizeof(T));
+        if (count == 0)
+        {
+            return {};
+        }
+        return {std::addressof(unchecked_at(index)), count};
+    }
+
+    // Relocates the elements at [from, from + count) of the array to [to, to + count).
+    // Requires `to <= from`.
+    constexpr void relocate_run(const std::size_t from,
+                                const std::size_t to,
+                                const std::size_t count)
+    {
+        if (from == to)
+        {
+            return;
+        }
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                OptionalT* const first =
+                    std::next(array().data(), static_cast<difference_type>(from));
+                algorithm::trivially_relocate(
+                    first,
+                    std::next(first, static_cast<difference_type>(count)),
+                    std::next(array().data(), static_cast<difference_type>(to)));
+                return;
+            }
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            emplace_at(to + i, std::move(unchecked_at(from + i)));
+            destroy_at(from + i);
+        }
+    }
+
+    // Rotates the elements at [0, last) of the array so that the one at `middle` comes first.
+    // Every index in [0, last) must hold an element.
+    constexpr void rotate_run_to_front(const std::size_t middle, const std::size_t last)
+    {
+        const auto reverse = [this](std::size_t first, std::size_t end)
+        {
+            for (; first + 1 < end; ++first, --end)
+            {
+                using std::swap;
+                swap(unchecked_at(first), unchecked_at(end - 1));
+            }
+        };
+        reverse(0, middle);
+        reverse(middle, last);
+        reverse(0, last);
+    }
+
     [[nodiscard]] constexpr std::size_t front_index() const
     {
-        return decrement_index_with_wraparound(starting_index_and_size().start, STARTING_OFFSET);
+        return array_index_of(starting_index_and_size().start);
     }
     [[nodiscard]] constexpr std::size_t back_index() const
     {
@@ -707,33 +1077,30 @@ private:
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
     }
     constexpr Array& array() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
-    [[nodiscard]] constexpr const StartingIntegerAndDistance& starting_index_and_size() const
+    [[nodiscard]] constexpr StartingIntegerAndDistance starting_index_and_size() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_;
-    }
-    constexpr StartingIntegerAndDistance& starting_index_and_size()
-    {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_;
+        return {.start = IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_,
+                .distance = IMPLEMENTATION_DETAIL_DO_NOT_USE_size_};
     }
 
     constexpr void increment_start(const std::size_t n = 1)
     {
-        starting_index_and_size().start += n;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ += n;
     }
     constexpr void decrement_start(const std::size_t n = 1)
     {
-        starting_index_and_size().start -= n;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ -= n;
     }
-    constexpr void set_start(const std::size_t start) { starting_index_and_size().start = start; }
-    constexpr void increment_size(const std::size_t n = 1)
+    constexpr void set_start(const std::size_t start)
     {
-        starting_index_and_size().distance += n;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ = start;
     }
-    constexpr void decrement_size(const std::size_t n = 1)
+    constexpr void increment_size(const std::size_t n = 1) { set_size(size() + n); }
+    constexpr void decrement_size(const std::size_t n = 1) { set_size(size() - n); }
+    constexpr void set_size(const std::size_t size)
     {
-        starting_index_and_size().distance -= n;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = static_cast<SizeStorageType>(size);
     }
-    constexpr void set_size(const std::size_t size) { starting_index_and_size().distance = size; }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
     {
@@ -1020,6 +1387,16 @@ constexpr typename FixedDeque<T, MAXIMUM_SIZE, CheckingType>::size_type erase_if
     return original_size - container.size();
 }
 
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
+constexpr typename FixedDeque<T, MAXIMUM_SIZE, CheckingType>::size_type erase_unordered_if(
+    FixedDeque<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    const auto original_size = container.size();
+    container.erase(algorithm::unstable_remove_if(container.begin(), container.end(), predicate),
+                    container.end());
+    return original_size - container.size();
+}
+
 /**
  * Construct a FixedDeque with its capacity being deduced from the number of items being passed.
  */
@@ -3,7 +3,9 @@
 #include "fixed_containers/fixed_index_based_storage.hpp"
 
 #include <array>
+#include <cstddef>
 #include <limits>
+#include <utility>
 
 namespace fixed_containers::fixed_doubly_linked_list_detail
 {
@@ -20,6 +22,7 @@ class FixedDoublyLinkedListBase
     static_assert(MAXIMUM_SIZE + 1 <= (std::numeric_limits<IndexType>::max)(),
                   "must be able to index MAXIMUM_SIZE+1 elements with IndexType");
     using StorageType = FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>;
+    static_assert(IsFixedIndexBasedBulkStorage<StorageType>);
     using ChainEntryType = LinkedListIndices<IndexType>;
     using ChainType = std::array<ChainEntryType, MAXIMUM_SIZE + 1>;
 
@@ -53,7 +56,11 @@ public:
 
     constexpr void clear() noexcept
     {
-        delete_range_and_return_next_index(front_index(), MAXIMUM_SIZE);
+        // No need to unlink one by one, the storage visits the live entries directly
+        storage().clear();
+        next_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        prev_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
     }
 
     [[nodiscard]] constexpr const T& at(const IndexType index) const { return storage().at(index); }
@@ -113,6 +120,125 @@ public:
         return idx;
     }
 
+    // Relinks [from_index_inclusive, to_index_exclusive) to just before `pos_index`. No values are
+    // moved. `pos_index` must not be inside the range.
+    constexpr void splice_range_before_index(const IndexType pos_index,
+                                             const IndexType from_index_inclusive,
+                                             const IndexType to_index_exclusive)
+    {
+        if (from_index_inclusive == to_index_exclusive || pos_index == from_index_inclusive ||
+            pos_index == to_index_exclusive)
+        {
+            return;
+        }
+        const IndexType last_index_inclusive = prev_of(to_index_exclusive);
+
+        next_of(prev_of(from_index_inclusive)) = to_index_exclusive;
+        prev_of(to_index_exclusive) = prev_of(from_index_inclusive);
+
+        prev_of(from_index_inclusive) = prev_of(pos_index);
+        next_of(prev_of(pos_index)) = from_index_inclusive;
+        next_of(last_index_inclusive) = pos_index;
+        prev_of(pos_index) = last_index_inclusive;
+    }
+
+    // Stable bottom-up merge sort that only rewrites links; no values are moved.
+    // O(N log N) comparisons and O(1) extra space.
+    template <typename Compare>
+    constexpr void sort(Compare comp)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        // Work on the `next` links only, with NULL_INDEX terminating the chain. The sentinel's
+        // `next` is the head, so appending to a NULL_INDEX tail sets the head.
+        for (std::size_t run_length = 1;; run_length *= 2)
+        {
+            IndexType left = front_index();
+            IndexType tail = NULL_INDEX;
+            std::size_t merge_count = 0;
+
+            while (left != NULL_INDEX)
+            {
+                merge_count++;
+                IndexType right = left;
+                std::size_t left_length = 0;
+                while (left_length < run_length && right != NULL_INDEX)
+                {
+                    left_length++;
+                    right = next_of(right);
+                }
+                std::size_t right_length = run_length;
+
+                while (left_length > 0 || (right_length > 0 && right != NULL_INDEX))
+                {
+                    IndexType taken{};
+                    if (left_length == 0 ||
+                        (right_length > 0 && right != NULL_INDEX && comp(at(right), at(left))))
+                    {
+                        taken = right;
+                        right = next_of(right);
+                        right_length--;
+                    }
+                    else
+                    {
+                        taken = left;
+                        left = next_of(left);
+                        left_length--;
+                    }
+                    next_of(tail) = taken;
+                    tail = taken;
+                }
+                left = right;
+            }
+            next_of(tail) = NULL_INDEX;
+
+            if (merge_count <= 1)
+            {
+                break;
+            }
+        }
+
+        IndexType previous = NULL_INDEX;
+        for (IndexType i = front_index(); i != NULL_INDEX; i = next_of(i))
+        {
+            prev_of(i) = previous;
+            previous = i;
+        }
+        prev_of(NULL_INDEX) = previous;
+    }
+
+    // Renumbers the entries so that the list occupies indices 0, 1, ..., size() - 1 in order.
+    // Restores memory locality after long runs of insertions and deletions. Invalidates all
+    // indices.
+    constexpr void compact()
+    {
+        // Stash the rank of every entry in its `prev` link; forward traversal only needs `next`.
+        IndexType rank = 0;
+        for (IndexType i = front_index(); i != NULL_INDEX; ++rank)
+        {
+            const IndexType next = next_of(i);
+            prev_of(i) = rank;
+            i = next;
+        }
+
+        storage().compact(
+            [this](const std::size_t index)
+            { return static_cast<std::size_t>(prev_of(static_cast<IndexType>(index))); },
+            [this](const std::size_t first, const std::size_t second)
+            { std::swap(chain().at(first), chain().at(second)); });
+
+        for (IndexType i = 0; i < size(); i++)
+        {
+            prev_of(i) = i == 0 ? NULL_INDEX : static_cast<IndexType>(i - 1);
+            next_of(i) = i + 1 == size() ? NULL_INDEX : static_cast<IndexType>(i + 1);
+        }
+        next_of(NULL_INDEX) = size() == 0 ? NULL_INDEX : IndexType{0};
+        prev_of(NULL_INDEX) = size() == 0 ? NULL_INDEX : static_cast<IndexType>(size() - 1);
+    }
+
 public:
     [[nodiscard]] constexpr const IndexType& next_of(IndexType index) const
     {
@@ -198,18 +324,12 @@ public:
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
 
-        // Now the fun part. We need to setup the FixedIndexBasedPoolStorage to match the original.
-        // This has two parts:
-        // first, the freelist needs to match
-        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.set_freelist_state_from_other(
+        // Now the fun part. We need to setup the FixedIndexBasedPoolStorage to match the original:
+        // the freelist needs to match, and each value needs an explicit copy. The storage knows
+        // where the values are from its occupancy bitmap, which is a sequential scan instead of
+        // chasing the `chain_`.
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.copy_live_from(
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_);
-
-        // then we need to do an explicit copy of each value. We know where these are by using the
-        // `chain_`
-        for (auto i = other.front_index(); i != Base::NULL_INDEX; i = other.next_of(i))
-        {
-            std::construct_at(&this->at(i), other.at(i));
-        }
     }
 
     constexpr void nontrivial_move_impl(FixedDoublyLinkedList& other)
@@ -220,12 +340,8 @@ public:
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.size();
         this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
-        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.set_freelist_state_from_other(
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.move_live_from(
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_);
-        for (auto i = other.front_index(); i != Base::NULL_INDEX; i = other.next_of(i))
-        {
-            std::construct_at(&this->at(i), std::move(other.at(i)));
-        }
     }
 
     constexpr FixedDoublyLinkedList(const FixedDoublyLinkedList& other)
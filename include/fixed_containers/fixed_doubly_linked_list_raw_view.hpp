@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/forward_iterator.hpp"
 
 #include <cstddef>
@@ -88,8 +89,11 @@ public:
     [[nodiscard]] constexpr std::ptrdiff_t value_storage_size() const noexcept
     {
         // the full PoolStorage will be aligned to the alignment of the element, which matters if it
-        // aligns bigger than alignof(size_t)
-        std::size_t raw_size = max_elem_count_ * elem_size_bytes_ + sizeof(std::size_t);
+        // aligns bigger than alignof(size_t). After the array, it holds the next free index and
+        // the occupancy bitmap.
+        std::size_t raw_size =
+            (max_elem_count_ * elem_size_bytes_) + sizeof(std::size_t) +
+            fixed_index_based_storage_detail::slot_bitset_size_bytes(max_elem_count_);
         if (raw_size % elem_align_bytes_ != 0)
         {
             raw_size += elem_align_bytes_ - (raw_size % elem_align_bytes_);
@@ -119,7 +123,7 @@ public:
     {
         // this is _very_ brittle and reliant on the layout of `FixedDoublyLinkedList` _and_ the
         // layout of `FixedIndexBasedPoolStorage` the storage holds the array + 1 `std::size_t` for
-        // the next index
+        // the next index + the occupancy bitmap
         return reinterpret_cast<const ChainEntryType*>(std::next(list_ptr_, value_storage_size()));
     }
 
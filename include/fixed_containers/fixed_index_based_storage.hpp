@@ -1,14 +1,20 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/index_or_value_storage.hpp"
 #include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_reference.hpp"
 
 #include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <type_traits>
 
 namespace fixed_containers
@@ -26,11 +32,148 @@ concept IsFixedIndexBasedStorage = requires(
     mutable_instance.delete_at_and_return_repositioned_index(index);
 };
 
-template <class T, std::size_t MAXIMUM_SIZE>
-class FixedIndexBasedPoolStorage
+// Storage that can also visit, copy, move and compact all of its live entries at once. Containers
+// use these to avoid walking their own links, e.g. in copy constructors and `compact()`.
+template <class StorageType>
+concept IsFixedIndexBasedBulkStorage =
+    IsFixedIndexBasedStorage<StorageType> &&
+    requires(const StorageType& const_instance,
+             StorageType& mutable_instance,
+             void (*visit)(std::size_t),
+             std::size_t (*target_index_of)(std::size_t),
+             void (*on_relocate)(std::size_t, std::size_t)) {
+        const_instance.for_each_live(visit);
+        mutable_instance.clear();
+        mutable_instance.copy_live_from(const_instance);
+        mutable_instance.move_live_from(mutable_instance);
+        mutable_instance.compact(target_index_of, on_relocate);
+    };
+
+namespace fixed_index_based_storage_detail
+{
+// std::bitset is not sufficiently constexpr and cannot be scanned a word at a time, using a
+// std::array instead.
+template <std::size_t BIT_COUNT>
+struct SlotBitset
+{
+    using WordType = std::uint64_t;
+    static constexpr std::size_t BITS_PER_WORD = std::numeric_limits<WordType>::digits;
+    static constexpr std::size_t WORD_COUNT = (BIT_COUNT + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    // Public so this type is a structural type and can thus be used in template parameters
+    std::array<WordType, WORD_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_words_{};
+
+    [[nodiscard]] constexpr bool test(const std::size_t index) const
+    {
+        return (IMPLEMENTATION_DETAIL_DO_NOT_USE_words_[index / BITS_PER_WORD] &
+                mask_of(index)) != 0;
+    }
+    constexpr void set(const std::size_t index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_words_[index / BITS_PER_WORD] |= mask_of(index);
+    }
+    constexpr void reset(const std::size_t index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_words_[index / BITS_PER_WORD] &= ~mask_of(index);
+    }
+
+    // Returns BIT_COUNT if all bits are set.
+    [[nodiscard]] constexpr std::size_t find_first_unset() const
+    {
+        for (std::size_t word_index = 0; word_index < WORD_COUNT; word_index++)
+        {
+            const WordType word = IMPLEMENTATION_DETAIL_DO_NOT_USE_words_[word_index];
+            if (word != (std::numeric_limits<WordType>::max)())
+            {
+                const std::size_t index = (word_index * BITS_PER_WORD) +
+                                          static_cast<std::size_t>(std::countr_one(word));
+                return index < BIT_COUNT ? index : BIT_COUNT;
+            }
+        }
+        return BIT_COUNT;
+    }
+
+    // Calls `func(index)` for every set bit in ascending order, skipping a whole word at a time
+    // when it is empty. `func` may modify the bitset, the word that is being scanned is a copy.
+    template <class Func>
+    constexpr void for_each_set(Func&& func) const
+    {
+        for (std::size_t word_index = 0; word_index < WORD_COUNT; word_index++)
+        {
+            for (WordType word = IMPLEMENTATION_DETAIL_DO_NOT_USE_words_[word_index]; word != 0;
+                 word &= word - 1)
+            {
+                func((word_index * BITS_PER_WORD) +
+                     static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+private:
+    [[nodiscard]] static constexpr WordType mask_of(const std::size_t index)
+    {
+        return WordType{1} << (index % BITS_PER_WORD);
+    }
+};
+
+// Memory footprint of `SlotBitset<BIT_COUNT>`, for raw views that only know the count at runtime.
+constexpr std::size_t slot_bitset_size_bytes(const std::size_t bit_count)
+{
+    constexpr std::size_t BITS_PER_WORD = std::numeric_limits<std::uint64_t>::digits;
+    return ((bit_count + BITS_PER_WORD - 1) / BITS_PER_WORD) * sizeof(std::uint64_t);
+}
+
+// Moves the value of every occupied slot `i` to slot `target_index_of(i)`, following permutation
+// cycles so that every swap puts at least one value in its final position. `target_index_of` is
+// re-evaluated after each swap, so it must reflect whatever is currently stored at `i`.
+template <std::size_t MAXIMUM_SIZE, class TargetIndexOf, class SwapSlots, class MoveSlot>
+constexpr void permute_occupied_slots(SlotBitset<MAXIMUM_SIZE>& occupied,
+                                      const TargetIndexOf& target_index_of,
+                                      const SwapSlots& swap_slots,
+                                      const MoveSlot& move_slot)
+{
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        while (occupied.test(i))
+        {
+            const std::size_t target = target_index_of(i);
+            if (target == i)
+            {
+                break;
+            }
+            if (occupied.test(target))
+            {
+                swap_slots(i, target);
+            }
+            else
+            {
+                move_slot(i, target);
+                occupied.set(target);
+                occupied.reset(i);
+            }
+        }
+    }
+}
+
+enum class FreeListOrder
+{
+    // Freed slots are handed out first. O(1) allocation and deallocation, but after churn,
+    // consecutive allocations end up scattered across the array.
+    LIFO,
+    // The free list is kept sorted by index, so the lowest free slot is always handed out first.
+    // O(1) allocation, deallocation is linear in the number of free slots.
+    ADDRESS_ORDERED,
+};
+
+// Slots are threaded through a free list stored in the free slots themselves. A bitmap of the
+// occupied slots is kept alongside, so that the values can be visited without the external
+// structure (list or tree) that links them.
+template <class T, std::size_t MAXIMUM_SIZE, FreeListOrder ORDER>
+class FreeListPoolStorage
 {
     using IndexOrValueT = index_or_value_storage_detail::IndexOrValueStorage<T>;
     using IndexOrValueArray = std::array<IndexOrValueT, MAXIMUM_SIZE>;
+    using OccupiedSlots = SlotBitset<MAXIMUM_SIZE>;
 
 public:
     using size_type = typename IndexOrValueArray::size_type;
@@ -39,20 +182,52 @@ public:
 public:  // Public so this type is a structural type and can thus be used in template parameters
     IndexOrValueArray IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
     std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_;
+    OccupiedSlots IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
 
 public:
-    constexpr FixedIndexBasedPoolStorage() noexcept
+    constexpr FreeListPoolStorage() noexcept
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_array_{}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_{}
     {
-        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
-        {
-            array_unchecked_at(i).index = i + 1;
-        }
+        reset_free_list_starting_at(0);
     }
 
     [[nodiscard]] constexpr bool full() const noexcept { return next_index() == MAXIMUM_SIZE; }
 
+    [[nodiscard]] constexpr bool is_occupied(const std::size_t index) const noexcept
+    {
+        return occupied_slots().test(index);
+    }
+
+    // Calls `func(index)` for the index of every value, in ascending order. Empty regions are
+    // skipped 64 slots at a time.
+    template <class Func>
+    constexpr void for_each_live(Func&& func) const
+    {
+        occupied_slots().for_each_set(std::forward<Func>(func));
+    }
+
+    // Destroys all values. Only the occupied slots are visited.
+    constexpr void clear() noexcept
+    {
+        if constexpr (ORDER == FreeListOrder::LIFO)
+        {
+            for_each_live([this](const std::size_t index)
+                          { delete_at_and_return_repositioned_index(index); });
+        }
+        else
+        {
+            // Re-threading the whole free list in order is cheaper than sorted insertions
+            if constexpr (NotTriviallyDestructible<T>)
+            {
+                for_each_live([this](const std::size_t index) { destroy_at(index); });
+            }
+            occupied_slots() = OccupiedSlots{};
+            reset_free_list_starting_at(0);
+        }
+    }
+
     constexpr T& at(const std::size_t index) noexcept { return array_unchecked_at(index).value; }
     [[nodiscard]] constexpr const T& at(const std::size_t index) const noexcept
     {
@@ -66,23 +241,90 @@ public:
         const std::size_t index = next_index();
         set_next_index(array_unchecked_at(next_index()).index);
         emplace_at(index, std::forward<Args>(args)...);
+        occupied_slots().set(index);
         return index;
     }
 
     constexpr std::size_t delete_at_and_return_repositioned_index(const std::size_t index) noexcept
     {
         destroy_at(index);
-        array_unchecked_at(index).index = next_index();
-        set_next_index(index);
+        occupied_slots().reset(index);
+        if constexpr (ORDER == FreeListOrder::LIFO)
+        {
+            array_unchecked_at(index).index = next_index();
+            set_next_index(index);
+        }
+        else
+        {
+            if (next_index() > index)
+            {
+                array_unchecked_at(index).index = next_index();
+                set_next_index(index);
+                return index;
+            }
+            std::size_t previous_free = next_index();
+            while (array_unchecked_at(previous_free).index < index)
+            {
+                previous_free = array_unchecked_at(previous_free).index;
+            }
+            array_unchecked_at(index).index = array_unchecked_at(previous_free).index;
+            array_unchecked_at(previous_free).index = index;
+        }
         return index;
     }
 
+    // Moves the values so that they occupy slots [0, n), where n is the number of values. Every
+    // occupied slot `i` ends up at `target_index_of(i)`, which must map the occupied slots
+    // one-to-one onto [0, n). `on_relocate(i, j)` is invoked whenever the contents of slots `i`
+    // and `j` are exchanged, so that owners can keep per-slot side tables in sync. Afterwards,
+    // the free slots are handed out in ascending order.
+    template <class TargetIndexOf, class OnRelocate>
+    constexpr void compact(const TargetIndexOf& target_index_of, const OnRelocate& on_relocate)
+    {
+        std::size_t occupied_count = 0;
+        for_each_live([&occupied_count](const std::size_t /*index*/) { ++occupied_count; });
+
+        permute_occupied_slots(
+            occupied_slots(),
+            target_index_of,
+            [&](const std::size_t first, const std::size_t second)
+            {
+                T tmp{std::move(at(first))};
+                memory::destroy_and_construct_at_address_of(at(first), std::move(at(second)));
+                memory::destroy_and_construct_at_address_of(at(second), std::move(tmp));
+                on_relocate(first, second);
+            },
+            [&](const std::size_t from, const std::size_t to)
+            {
+                emplace_at(to, std::move(at(from)));
+                destroy_at(from);
+                on_relocate(from, to);
+            });
+
+        reset_free_list_starting_at(occupied_count);
+    }
+
+    // Copies the values and the free list of `other`, keeping every value at the same index.
+    // Assumes `this` does not currently contain any value.
+    constexpr void copy_live_from(const FreeListPoolStorage& other)
+    {
+        set_freelist_state_from_other(other);
+        other.for_each_live([&](const std::size_t index) { emplace_at(index, other.at(index)); });
+    }
+    // Same as `copy_live_from()`, but moves the values out of `other`.
+    constexpr void move_live_from(FreeListPoolStorage& other)
+    {
+        set_freelist_state_from_other(other);
+        other.for_each_live([&](const std::size_t index)
+                            { emplace_at(index, std::move(other.at(index))); });
+    }
+
     // Set the freelist of `this` to match the freelist of `other`. This only makes sense if
     // you will emplace valid values in the "full" spots (The ones not touched by this function). It
     // explicitly makes _no guarantees_ about the contents of "full" slots in the destination.
     // Warning: Assumes all the indices in `this` (destination) do not currently contain a
     // value!
-    constexpr void set_freelist_state_from_other(const FixedIndexBasedPoolStorage& other)
+    constexpr void set_freelist_state_from_other(const FreeListPoolStorage& other)
     {
         if (!std::is_constant_evaluated())
         {
@@ -108,6 +350,7 @@ public:
             }
         }
         this->set_next_index(other.next_index());
+        this->occupied_slots() = other.occupied_slots();
     }
 
 private:
@@ -127,6 +370,187 @@ private:
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = n;
     }
+    [[nodiscard]] constexpr const OccupiedSlots& occupied_slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
+    }
+    constexpr OccupiedSlots& occupied_slots()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
+    }
+
+    // Assumes slots [first_free_index, MAXIMUM_SIZE) do not contain a value.
+    constexpr void reset_free_list_starting_at(const std::size_t first_free_index)
+    {
+        for (std::size_t i = first_free_index; i < MAXIMUM_SIZE; i++)
+        {
+            array_unchecked_at(i).index = i + 1;
+        }
+        set_next_index(first_free_index);
+    }
+
+    template <class... Args>
+    constexpr void emplace_at(const std::size_t& index, Args&&... args)
+    {
+        memory::construct_at_address_of(
+            array_unchecked_at(index), std::in_place, std::forward<Args>(args)...);
+    }
+
+    constexpr void destroy_at(std::size_t index)
+    {
+        memory::destroy_at_address_of(array_unchecked_at(index).value);
+    }
+};
+
+}  // namespace fixed_index_based_storage_detail
+
+// Default pool storage. Freed slots are reused first (LIFO).
+template <class T, std::size_t MAXIMUM_SIZE>
+using FixedIndexBasedPoolStorage = fixed_index_based_storage_detail::
+    FreeListPoolStorage<T, MAXIMUM_SIZE, fixed_index_based_storage_detail::FreeListOrder::LIFO>;
+
+// Pool storage that always hands out the lowest free slot by keeping the free list sorted.
+// Keeps live entries clustered at the front of the array, at the cost of O(free slots)
+// deallocation. Same memory layout as `FixedIndexBasedPoolStorage`.
+template <class T, std::size_t MAXIMUM_SIZE>
+using FixedIndexBasedAddressOrderedPoolStorage =
+    fixed_index_based_storage_detail::FreeListPoolStorage<
+        T,
+        MAXIMUM_SIZE,
+        fixed_index_based_storage_detail::FreeListOrder::ADDRESS_ORDERED>;
+
+// Pool storage that always hands out the lowest free slot by scanning the bitmap of occupied slots
+// with `countr_one`. O(1) deallocation and O(MAXIMUM_SIZE / 64) allocation, and no free list.
+template <class T, std::size_t MAXIMUM_SIZE>
+class FixedIndexBasedLowestIndexPoolStorage
+{
+    using IndexOrValueT = index_or_value_storage_detail::IndexOrValueStorage<T>;
+    using IndexOrValueArray = std::array<IndexOrValueT, MAXIMUM_SIZE>;
+    using OccupiedSlots = fixed_index_based_storage_detail::SlotBitset<MAXIMUM_SIZE>;
+
+public:
+    using size_type = typename IndexOrValueArray::size_type;
+    using difference_type = typename IndexOrValueArray::difference_type;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    IndexOrValueArray IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
+    OccupiedSlots IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedIndexBasedLowestIndexPoolStorage() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_array_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+    {
+    }
+
+    [[nodiscard]] constexpr bool full() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ == MAXIMUM_SIZE;
+    }
+
+    [[nodiscard]] constexpr bool is_occupied(const std::size_t index) const noexcept
+    {
+        return occupied_slots().test(index);
+    }
+
+    // See `FixedIndexBasedPoolStorage::for_each_live()`.
+    template <class Func>
+    constexpr void for_each_live(Func&& func) const
+    {
+        occupied_slots().for_each_set(std::forward<Func>(func));
+    }
+
+    constexpr void clear() noexcept
+    {
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            for_each_live([this](const std::size_t index) { destroy_at(index); });
+        }
+        occupied_slots() = OccupiedSlots{};
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+    constexpr T& at(const std::size_t index) noexcept { return array_unchecked_at(index).value; }
+    [[nodiscard]] constexpr const T& at(const std::size_t index) const noexcept
+    {
+        return array_unchecked_at(index).value;
+    }
+
+    template <class... Args>
+    constexpr std::size_t emplace_and_return_index(Args&&... args)
+    {
+        assert_or_abort(!full());
+        const std::size_t index = occupied_slots().find_first_unset();
+        emplace_at(index, std::forward<Args>(args)...);
+        occupied_slots().set(index);
+        ++IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        return index;
+    }
+
+    constexpr std::size_t delete_at_and_return_repositioned_index(const std::size_t index) noexcept
+    {
+        destroy_at(index);
+        occupied_slots().reset(index);
+        --IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        return index;
+    }
+
+    // See `FixedIndexBasedPoolStorage::compact()`.
+    template <class TargetIndexOf, class OnRelocate>
+    constexpr void compact(const TargetIndexOf& target_index_of, const OnRelocate& on_relocate)
+    {
+        fixed_index_based_storage_detail::permute_occupied_slots(
+            occupied_slots(),
+            target_index_of,
+            [&](const std::size_t first, const std::size_t second)
+            {
+                T tmp{std::move(at(first))};
+                memory::destroy_and_construct_at_address_of(at(first), std::move(at(second)));
+                memory::destroy_and_construct_at_address_of(at(second), std::move(tmp));
+                on_relocate(first, second);
+            },
+            [&](const std::size_t from, const std::size_t to)
+            {
+                emplace_at(to, std::move(at(from)));
+                destroy_at(from);
+                on_relocate(from, to);
+            });
+    }
+
+    // See `FixedIndexBasedPoolStorage::copy_live_from()`.
+    constexpr void copy_live_from(const FixedIndexBasedLowestIndexPoolStorage& other)
+    {
+        other.for_each_live([&](const std::size_t index) { emplace_at(index, other.at(index)); });
+        occupied_slots() = other.occupied_slots();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    constexpr void move_live_from(FixedIndexBasedLowestIndexPoolStorage& other)
+    {
+        other.for_each_live([&](const std::size_t index)
+                            { emplace_at(index, std::move(other.at(index))); });
+        occupied_slots() = other.occupied_slots();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+
+private:
+    [[nodiscard]] constexpr const IndexOrValueT& array_unchecked_at(const std::size_t index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[index];
+    }
+    constexpr IndexOrValueT& array_unchecked_at(const std::size_t index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[index];
+    }
+    [[nodiscard]] constexpr const OccupiedSlots& occupied_slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
+    }
+    constexpr OccupiedSlots& occupied_slots()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_occupied_slots_;
+    }
 
     template <class... Args>
     constexpr void emplace_at(const std::size_t& index, Args&&... args)
@@ -141,6 +565,230 @@ private:
     }
 };
 
+// Handle returned by `FixedIndexBasedGenerationalPoolStorage`. Packs the index of the slot
+// together with the generation the slot had when the handle was issued.
+// A default-constructed handle is never valid.
+struct GenerationalIndex
+{
+    std::uint32_t index{};
+    std::uint32_t generation{};
+
+    constexpr bool operator==(const GenerationalIndex& other) const = default;
+};
+
+// Wraps `FixedIndexBasedPoolStorage` and stores a generation counter for every slot. The counter
+// is bumped on every emplace and every delete, so it is odd while the slot holds a value and even
+// while the slot is free. A `GenerationalIndex` is only valid while the generation it carries
+// matches the one of the slot, which gives O(1) detection of stale handles (use-after-free or ABA
+// from slot reuse). A slot can be reused 2^31 times before a stale handle may alias again.
+//
+// Like `FixedIndexBasedPoolStorage`, this class does not destroy the remaining values on
+// destruction; that is the responsibility of the owner.
+template <class T, std::size_t MAXIMUM_SIZE>
+class FixedIndexBasedGenerationalPoolStorage
+{
+    static_assert(MAXIMUM_SIZE <= (std::numeric_limits<std::uint32_t>::max)(),
+                  "must be able to index MAXIMUM_SIZE elements with GenerationalIndex");
+    using StorageType = FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>;
+    using GenerationArray = std::array<std::uint32_t, MAXIMUM_SIZE>;
+
+public:
+    using size_type = typename StorageType::size_type;
+    using difference_type = typename StorageType::difference_type;
+    using handle_type = GenerationalIndex;
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    GenerationArray IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_;
+
+public:
+    constexpr FixedIndexBasedGenerationalPoolStorage() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_{}
+    {
+    }
+
+    [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
+
+    [[nodiscard]] constexpr bool is_occupied(const std::size_t index) const noexcept
+    {
+        return storage().is_occupied(index);
+    }
+
+    template <class Func>
+    constexpr void for_each_live(Func&& func) const
+    {
+        storage().for_each_live(std::forward<Func>(func));
+    }
+
+    // Destroys all values. The generation of every occupied slot is bumped, so all outstanding
+    // handles become stale.
+    constexpr void clear() noexcept
+    {
+        for_each_live([this](const std::size_t index) { ++generation_at(index); });
+        storage().clear();
+    }
+
+    // See `FixedIndexBasedPoolStorage::compact()`. Relocated values get a new generation in their
+    // new slot, so handles that referred to them by their old index become stale.
+    template <class TargetIndexOf, class OnRelocate>
+    constexpr void compact(const TargetIndexOf& target_index_of, const OnRelocate& on_relocate)
+    {
+        storage().compact(target_index_of,
+                          [&](const std::size_t from, const std::size_t to)
+                          {
+                              if (is_occupied_generation(generation_at(to)))
+                              {
+                                  // Swapped two values, both slots stay occupied
+                                  generation_at(from) += 2;
+                                  generation_at(to) += 2;
+                              }
+                              else
+                              {
+                                  ++generation_at(from);
+                                  ++generation_at(to);
+                              }
+                              on_relocate(from, to);
+                          });
+    }
+
+    // See `FixedIndexBasedPoolStorage::copy_live_from()`. Handles of `other` stay valid for the
+    // copy, unless that would bring back a generation this storage already used; then a newer
+    // one is picked so that no stale handle of `this` becomes valid again.
+    constexpr void copy_live_from(const FixedIndexBasedGenerationalPoolStorage& other)
+    {
+        storage().copy_live_from(other.storage());
+        adopt_generations_of(other);
+    }
+    // Same as `copy_live_from()`, but moves the values out of `other`.
+    constexpr void move_live_from(FixedIndexBasedGenerationalPoolStorage& other)
+    {
+        storage().move_live_from(other.storage());
+        adopt_generations_of(other);
+    }
+
+    constexpr T& at(const std::size_t index) noexcept { return storage().at(index); }
+    [[nodiscard]] constexpr const T& at(const std::size_t index) const noexcept
+    {
+        return storage().at(index);
+    }
+
+    constexpr T& at(const GenerationalIndex& handle) noexcept
+    {
+        assert_or_abort(contains(handle));
+        return storage().at(handle.index);
+    }
+    [[nodiscard]] constexpr const T& at(const GenerationalIndex& handle) const noexcept
+    {
+        assert_or_abort(contains(handle));
+        return storage().at(handle.index);
+    }
+
+    constexpr OptionalReference<T> try_at(const GenerationalIndex& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<T>{storage().at(handle.index)};
+    }
+    [[nodiscard]] constexpr OptionalReference<const T> try_at(
+        const GenerationalIndex& handle) const noexcept
+    {
+        if (!contains(handle))
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<const T>{storage().at(handle.index)};
+    }
+
+    [[nodiscard]] constexpr bool contains(const GenerationalIndex& handle) const noexcept
+    {
+        // Handles are only issued with odd (occupied) generations. Checking the parity rejects
+        // default-constructed handles, which would otherwise match a slot that was never used.
+        return is_occupied_generation(handle.generation) && handle.index < MAXIMUM_SIZE &&
+               generation_at(handle.index) == handle.generation;
+    }
+
+    [[nodiscard]] constexpr bool contains_at(const std::size_t index) const noexcept
+    {
+        return index < MAXIMUM_SIZE && is_occupied_generation(generation_at(index));
+    }
+
+    // Returns the handle that currently refers to the value at `index`.
+    [[nodiscard]] constexpr GenerationalIndex handle_of(const std::size_t index) const noexcept
+    {
+        assert_or_abort(contains_at(index));
+        return {static_cast<std::uint32_t>(index), generation_at(index)};
+    }
+
+    template <class... Args>
+    constexpr std::size_t emplace_and_return_index(Args&&... args)
+    {
+        const std::size_t index = storage().emplace_and_return_index(std::forward<Args>(args)...);
+        ++generation_at(index);
+        return index;
+    }
+
+    template <class... Args>
+    constexpr GenerationalIndex emplace_and_return_handle(Args&&... args)
+    {
+        return handle_of(emplace_and_return_index(std::forward<Args>(args)...));
+    }
+
+    constexpr std::size_t delete_at_and_return_repositioned_index(const std::size_t index) noexcept
+    {
+        assert_or_abort(contains_at(index));
+        ++generation_at(index);
+        return storage().delete_at_and_return_repositioned_index(index);
+    }
+
+    // Returns whether a value was deleted. Stale handles are ignored.
+    constexpr bool delete_at(const GenerationalIndex& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+        delete_at_and_return_repositioned_index(handle.index);
+        return true;
+    }
+
+private:
+    [[nodiscard]] static constexpr bool is_occupied_generation(const std::uint32_t generation)
+    {
+        return (generation & 1U) == 1U;
+    }
+
+    // Assumes no slot of `this` held a value before `other`'s values were placed in it.
+    constexpr void adopt_generations_of(const FixedIndexBasedGenerationalPoolStorage& other)
+    {
+        other.for_each_live(
+            [&](const std::size_t index)
+            {
+                const std::uint32_t other_generation = other.generation_at(index);
+                generation_at(index) = other_generation > generation_at(index)
+                                           ? other_generation
+                                           : generation_at(index) + 1;
+            });
+    }
+
+    [[nodiscard]] constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+
+    [[nodiscard]] constexpr const std::uint32_t& generation_at(const std::size_t index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_[index];
+    }
+    constexpr std::uint32_t& generation_at(const std::size_t index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_[index];
+    }
+};
+
 // This allocator keeps entries contiguous in memory - no gaps.
 // To achieve that, every time an entry is removed, it is filled by moving the last entry in its
 // place (this is O(1)).
@@ -164,6 +812,31 @@ public:
 
     [[nodiscard]] constexpr bool full() const noexcept { return nodes().full(); }
 
+    [[nodiscard]] constexpr bool is_occupied(const std::size_t index) const noexcept
+    {
+        return index < nodes().size();
+    }
+
+    template <class Func>
+    constexpr void for_each_live(Func&& func) const
+    {
+        for (std::size_t i = 0; i < nodes().size(); i++)
+        {
+            func(i);
+        }
+    }
+
+    constexpr void clear() noexcept { nodes().clear(); }
+
+    constexpr void copy_live_from(const FixedIndexBasedContiguousStorage& other)
+    {
+        nodes() = other.nodes();
+    }
+    constexpr void move_live_from(FixedIndexBasedContiguousStorage& other)
+    {
+        nodes() = std::move(other.nodes());
+    }
+
     constexpr T& at(const std::size_t index) noexcept { return nodes().at(index); }
     [[nodiscard]] constexpr const T& at(const std::size_t index) const noexcept
     {
@@ -185,6 +858,25 @@ public:
         return nodes().size();
     }
 
+    // See `FixedIndexBasedPoolStorage::compact()`. Entries are already contiguous, so this only
+    // reorders them.
+    template <class TargetIndexOf, class OnRelocate>
+    constexpr void compact(const TargetIndexOf& target_index_of, const OnRelocate& on_relocate)
+    {
+        for (std::size_t i = 0; i < nodes().size(); i++)
+        {
+            for (std::size_t target = target_index_of(i); target != i;
+                 target = target_index_of(i))
+            {
+                T tmp{std::move(nodes().at(i))};
+                memory::destroy_and_construct_at_address_of(nodes().at(i),
+                                                            std::move(nodes().at(target)));
+                memory::destroy_and_construct_at_address_of(nodes().at(target), std::move(tmp));
+                on_relocate(i, target);
+            }
+        }
+    }
+
 private:
     [[nodiscard]] constexpr const FixedVector<T, MAXIMUM_SIZE>& nodes() const
     {
@@ -0,0 +1,372 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_priority_queue.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity priority queue whose elements can be addressed after insertion, for
+ * decrease-key style algorithms (timers being rearmed or cancelled, Dijkstra).
+ *
+ * Same heap as `FixedPriorityQueue`, plus the same indirection as `FixedSlotMap`: `push()`
+ * returns a `GenerationalIndex` handle that stays valid while the element moves around the heap,
+ * until the element is popped or erased. `update_priority()` and `erase()` are O(log n), and
+ * stale handles are detected.
+ *
+ * Elements can only be read through the queue; changing one must go through
+ * `update_priority()`, so that the heap order is restored.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedIndexedPriorityQueue
+{
+    static_assert(ARITY >= 2, "ARITY must be at least 2");
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedIndexedPriorityQueue must have a non-const, non-volatile value_type");
+    using Checking = CheckingType;
+    using Values = FixedVector<T, MAXIMUM_SIZE, CheckingType>;
+    // Handle -> heap position
+    using Slots = FixedIndexBasedGenerationalPoolStorage<std::size_t, MAXIMUM_SIZE>;
+    // Heap position -> handle index. Needed to patch the handles of the elements that are moved
+    // by the heap operations.
+    using SlotIndexes = FixedVector<std::size_t, MAXIMUM_SIZE>;
+
+    static constexpr auto parent_of = fixed_priority_queue_detail::parent_of<ARITY>;
+    static constexpr auto first_child_of = fixed_priority_queue_detail::first_child_of<ARITY>;
+
+public:
+    using value_compare = Compare;
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const T&;
+    using handle_type = GenerationalIndex;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Slots IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    Values IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    SlotIndexes IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedIndexedPriorityQueue() noexcept
+      : FixedIndexedPriorityQueue{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedIndexedPriorityQueue(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return values().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr value_compare value_comp() const { return comparator(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return values().front(loc);
+    }
+    [[nodiscard]] constexpr handle_type top_handle(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return slots().handle_of(slot_indexes()[0]);
+    }
+
+    constexpr handle_type push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        values().push_back(value);
+        return register_back();
+    }
+    constexpr handle_type push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        values().push_back(std::move(value));
+        return register_back();
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        values().emplace_back(std::forward<Args>(args)...);
+        return register_back();
+    }
+
+    /**
+     * Removes the top element. Its handle becomes invalid.
+     */
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        erase_at_position(0);
+    }
+
+    /**
+     * Erases the element referred to by `handle`. Returns the number of erased elements (0 or 1).
+     */
+    constexpr size_type erase(const handle_type& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return 0;
+        }
+        erase_at_position(slots().at(handle));
+        return 1;
+    }
+
+    /**
+     * Replaces the element referred to by `handle` with `value`, and moves it up or down the heap
+     * accordingly. `handle` stays valid.
+     */
+    constexpr void update_priority(
+        const handle_type& handle,
+        value_type value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        restore_heap_at(slots().at(handle), std::move(value), handle.index);
+    }
+
+    /**
+     * Erases all elements. All outstanding handles become invalid.
+     */
+    constexpr void clear() noexcept
+    {
+        for (const std::size_t slot_index : slot_indexes())
+        {
+            slots().delete_at_and_return_repositioned_index(slot_index);
+        }
+        slot_indexes().clear();
+        values().clear();
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type& handle) const noexcept
+    {
+        return slots().contains(handle);
+    }
+
+    [[nodiscard]] constexpr const_reference at(
+        const handle_type& handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_contains(handle, loc);
+        return values()[slots().at(handle)];
+    }
+    constexpr const_reference operator[](const handle_type& handle) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(handle, std_transition::source_location::current());
+    }
+
+private:
+    constexpr handle_type register_back()
+    {
+        const std::size_t position = size() - 1;
+        const handle_type handle = slots().emplace_and_return_handle(position);
+        slot_indexes().push_back(handle.index);
+        value_type value = std::move(values()[position]);
+        sift_up(position, std::move(value), handle.index);
+        return handle;
+    }
+
+    constexpr void erase_at_position(const std::size_t position)
+    {
+        slots().delete_at_and_return_repositioned_index(slot_indexes()[position]);
+        const std::size_t last_position = size() - 1;
+        if (position == last_position)
+        {
+            values().pop_back();
+            slot_indexes().pop_back();
+            return;
+        }
+        // The last element fills the hole, and the erased one is overwritten on the way
+        value_type last = std::move(values()[last_position]);
+        const std::size_t last_slot_index = slot_indexes()[last_position];
+        values().pop_back();
+        slot_indexes().pop_back();
+        restore_heap_at(position, std::move(last), last_slot_index);
+    }
+
+    // Puts `value` into the heap at `hole`, moving it up or down as needed
+    constexpr void restore_heap_at(const std::size_t hole,
+                                   value_type value,
+                                   const std::size_t slot_index)
+    {
+        if (hole > 0 && comparator()(values()[parent_of(hole)], value))
+        {
+            sift_up(hole, std::move(value), slot_index);
+        }
+        else
+        {
+            sift_down(hole, std::move(value), slot_index);
+        }
+    }
+
+    constexpr void sift_up(std::size_t hole, value_type value, const std::size_t slot_index)
+    {
+        while (hole > 0)
+        {
+            const std::size_t parent = parent_of(hole);
+            if (!comparator()(values()[parent], value))
+            {
+                break;
+            }
+            move_into_hole(parent, hole);
+            hole = parent;
+        }
+        place(hole, std::move(value), slot_index);
+    }
+
+    constexpr void sift_down(std::size_t hole, value_type value, const std::size_t slot_index)
+    {
+        const std::size_t count = size();
+        while (true)
+        {
+            const std::size_t first_child = first_child_of(hole);
+            if (first_child >= count)
+            {
+                break;
+            }
+            const std::size_t end_child = (std::min)(first_child + ARITY, count);
+            std::size_t greatest_child = first_child;
+            for (std::size_t child = first_child + 1; child < end_child; child++)
+            {
+                if (comparator()(values()[greatest_child], values()[child]))
+                {
+                    greatest_child = child;
+                }
+            }
+            if (!comparator()(value, values()[greatest_child]))
+            {
+                break;
+            }
+            move_into_hole(greatest_child, hole);
+            hole = greatest_child;
+        }
+        place(hole, std::move(value), slot_index);
+    }
+
+    // Every element that moves takes its handle along
+    constexpr void move_into_hole(const std::size_t from, const std::size_t hole)
+    {
+        values()[hole] = std::move(values()[from]);
+        slot_indexes()[hole] = slot_indexes()[from];
+        slots().at(slot_indexes()[hole]) = hole;
+    }
+    constexpr void place(const std::size_t hole, value_type value, const std::size_t slot_index)
+    {
+        values()[hole] = std::move(value);
+        slot_indexes()[hole] = slot_index;
+        slots().at(slot_index) = hole;
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+    constexpr void check_contains(const handle_type& handle,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(handle)))
+        {
+            Checking::invalid_argument("handle is stale or invalid", loc);
+        }
+    }
+
+    [[nodiscard]] constexpr const Slots& slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    }
+    constexpr Slots& slots() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_; }
+    [[nodiscard]] constexpr const Values& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr Values& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    [[nodiscard]] constexpr const SlotIndexes& slot_indexes() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_;
+    }
+    constexpr SlotIndexes& slot_indexes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_; }
+    [[nodiscard]] constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedIndexedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
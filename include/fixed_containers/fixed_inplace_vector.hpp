@@ -0,0 +1,678 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/int_math.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed pool of `BLOCK_COUNT` blocks, each holding up to `BLOCK_CAPACITY` elements, that
+ * `FixedInplaceVector` instances borrow from when they outgrow their inline buffer.
+ *
+ * The arena must outlive every vector that refers to it.
+ */
+template <typename T, std::size_t BLOCK_CAPACITY, std::size_t BLOCK_COUNT>
+class FixedInplaceVectorArena
+{
+public:
+    using value_type = T;
+    using Block = FixedVector<T, BLOCK_CAPACITY>;
+
+private:
+    using StorageType = FixedIndexBasedPoolStorage<Block, BLOCK_COUNT>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t block_capacity() noexcept { return BLOCK_CAPACITY; }
+    [[nodiscard]] static constexpr std::size_t block_count() noexcept { return BLOCK_COUNT; }
+
+public:
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_blocks_in_use_;
+
+public:
+    constexpr FixedInplaceVectorArena() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_blocks_in_use_{}
+    {
+    }
+
+    // Blocks are handed out by index, so the arena must not be moved or copied while in use
+    FixedInplaceVectorArena(const FixedInplaceVectorArena&) = delete;
+    FixedInplaceVectorArena(FixedInplaceVectorArena&&) noexcept = delete;
+    FixedInplaceVectorArena& operator=(const FixedInplaceVectorArena&) = delete;
+    FixedInplaceVectorArena& operator=(FixedInplaceVectorArena&&) noexcept = delete;
+
+    constexpr ~FixedInplaceVectorArena() noexcept { storage().clear(); }
+
+    [[nodiscard]] constexpr std::size_t blocks_in_use() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_blocks_in_use_;
+    }
+    [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
+
+    /**
+     * Returns the index of an empty block. Calling acquire on a full arena is undefined.
+     */
+    constexpr std::size_t acquire()
+    {
+        ++IMPLEMENTATION_DETAIL_DO_NOT_USE_blocks_in_use_;
+        return storage().emplace_and_return_index();
+    }
+    /**
+     * Destroys the contents of the given block and returns it to the arena.
+     */
+    constexpr void release(const std::size_t block_index)
+    {
+        storage().delete_at_and_return_repositioned_index(block_index);
+        --IMPLEMENTATION_DETAIL_DO_NOT_USE_blocks_in_use_;
+    }
+
+    [[nodiscard]] constexpr const Block& block_at(const std::size_t block_index) const
+    {
+        return storage().at(block_index);
+    }
+    constexpr Block& block_at(const std::size_t block_index) { return storage().at(block_index); }
+
+private:
+    [[nodiscard]] constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+};
+
+/**
+ * Vector that holds up to `INLINE_CAPACITY` elements inline and, once it grows beyond that,
+ * moves its elements into a block borrowed from a caller-provided `FixedInplaceVectorArena`.
+ * Meant for many small lists with a large worst case: each instance only pays for the inline
+ * buffer, and the worst case is paid once per block in the shared arena instead of per instance.
+ * The elements are always contiguous, either in the inline buffer or in the borrowed block.
+ *
+ * The block is returned to the arena by `clear()`, `shrink_to_fit()` (when the elements fit
+ * inline again) and the destructor. A vector without an arena never grows past
+ * `INLINE_CAPACITY`.
+ *
+ * Properties:
+ *  - constexpr
+ *  - no dynamic allocations
+ *  - iterators and references are invalidated when the elements move to or from the arena
+ */
+template <typename T,
+          std::size_t INLINE_CAPACITY,
+          typename ArenaType,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, ArenaType::block_capacity()>>
+class FixedInplaceVector
+{
+    static_assert(std::same_as<typename ArenaType::value_type, T>,
+                  "The arena must hold blocks of the same value_type");
+    static_assert(INLINE_CAPACITY < ArenaType::block_capacity(),
+                  "The arena blocks must be larger than the inline buffer");
+
+    using Checking = CheckingType;
+    using InlineStorage = FixedVector<T, INLINE_CAPACITY>;
+    using BlockIndexType = int_math::SmallestUnsignedIntegralFor<ArenaType::block_count()>;
+    // Block index that denotes that the elements are stored inline
+    static constexpr BlockIndexType NO_BLOCK =
+        static_cast<BlockIndexType>(ArenaType::block_count());
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using arena_type = ArenaType;
+
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept
+    {
+        return ArenaType::block_capacity();
+    }
+    [[nodiscard]] static constexpr std::size_t inline_capacity() noexcept
+    {
+        return INLINE_CAPACITY;
+    }
+
+public:
+    InlineStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_inline_storage_;
+    ArenaType* IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+    BlockIndexType IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_;
+
+public:
+    constexpr FixedInplaceVector() noexcept
+      : FixedInplaceVector(nullptr)
+    {
+    }
+    explicit constexpr FixedInplaceVector(ArenaType& arena) noexcept
+      : FixedInplaceVector(std::addressof(arena))
+    {
+    }
+    constexpr FixedInplaceVector(ArenaType& arena,
+                                 std::initializer_list<T> list,
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current())
+      : FixedInplaceVector(arena)
+    {
+        reserve(list.size(), loc);
+        for (const T& value : list)
+        {
+            active_storage_push_back(value);
+        }
+    }
+
+    /**
+     * Copies borrow a block of their own from the same arena when `other` does not fit inline.
+     */
+    constexpr FixedInplaceVector(const FixedInplaceVector& other)
+      : FixedInplaceVector(other.arena())
+    {
+        copy_from(other);
+    }
+    /**
+     * Moves take over the block of `other`, if any, without touching the elements.
+     */
+    constexpr FixedInplaceVector(FixedInplaceVector&& other) noexcept
+      : FixedInplaceVector(other.arena())
+    {
+        steal_from(other);
+    }
+    constexpr FixedInplaceVector& operator=(const FixedInplaceVector& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_ = other.arena();
+        copy_from(other);
+        return *this;
+    }
+    constexpr FixedInplaceVector& operator=(FixedInplaceVector&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_ = other.arena();
+        steal_from(other);
+        return *this;
+    }
+
+    constexpr ~FixedInplaceVector() noexcept { release_block(); }
+
+public:
+    /**
+     * Whether the elements currently live in a block borrowed from the arena.
+     */
+    [[nodiscard]] constexpr bool uses_arena() const noexcept { return block_index() != NO_BLOCK; }
+
+    /**
+     * Makes room for `count` elements, borrowing a block from the arena if needed.
+     */
+    constexpr void reserve(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (count <= capacity())
+        {
+            return;
+        }
+        check_can_borrow_block(count, loc);
+        move_to_block(arena()->acquire());
+    }
+
+    /**
+     * Moves the elements back into the inline buffer and returns the block to the arena, if they
+     * fit.
+     */
+    constexpr void shrink_to_fit()
+    {
+        if (!uses_arena() || size() > INLINE_CAPACITY)
+        {
+            return;
+        }
+        auto& block = arena_block();
+        for (T& value : block)
+        {
+            inline_storage().push_back(std::move(value));
+        }
+        release_block();
+    }
+
+    constexpr void push_back(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        emplace_at_index(size(), loc, value);
+    }
+    constexpr void push_back(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        emplace_at_index(size(), loc, std::move(value));
+    }
+    template <class... Args>
+    constexpr reference emplace_back(Args&&... args)
+    {
+        return *emplace_at_index(
+            size(), std_transition::source_location::current(), std::forward<Args>(args)...);
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        visit_storage([](auto& storage) { storage.pop_back(); });
+    }
+
+    constexpr iterator insert(
+        const_iterator pos,
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_at_index(index_of(pos, loc), loc, value);
+    }
+    constexpr iterator insert(
+        const_iterator pos,
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return emplace_at_index(index_of(pos, loc), loc, std::move(value));
+    }
+
+    constexpr iterator erase(const_iterator first,
+                             const_iterator last,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current())
+    {
+        if (preconditions::test(first <= last))
+        {
+            Checking::invalid_argument("first > last, range is invalid", loc);
+        }
+        const auto first_index = static_cast<difference_type>(index_of(first, loc));
+        const auto last_index = static_cast<difference_type>(index_of(last, loc));
+        visit_storage(
+            [&](auto& storage)
+            {
+                storage.erase(std::next(storage.cbegin(), first_index),
+                              std::next(storage.cbegin(), last_index));
+            });
+        return std::next(begin(), first_index);
+    }
+    constexpr iterator erase(
+        const_iterator pos,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (preconditions::test(pos != cend()))
+        {
+            Checking::invalid_argument("pos != cend(), invalid parameter", loc);
+        }
+        return erase(pos, std::next(pos), loc);
+    }
+
+    /**
+     * Resizes the container to contain `count` elements, borrowing a block from the arena if
+     * needed. The block is kept when shrinking, see `shrink_to_fit()`.
+     */
+    constexpr void resize(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        reserve(count, loc);
+        visit_storage([count](auto& storage) { storage.resize(count); });
+    }
+
+    /**
+     * Erases all elements and returns the block, if any, to the arena.
+     */
+    constexpr void clear() noexcept
+    {
+        inline_storage().clear();
+        release_block();
+    }
+
+    constexpr reference operator[](size_type index) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type index) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+    constexpr reference at(size_type index,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_index(index, loc);
+        return data()[index];
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type index,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_index(index, loc);
+        return data()[index];
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return data()[0];
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return data()[0];
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return data()[size() - 1];
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return data()[size() - 1];
+    }
+
+    constexpr pointer data() noexcept
+    {
+        return visit_storage([](auto& storage) -> pointer { return storage.data(); });
+    }
+    [[nodiscard]] constexpr const_pointer data() const noexcept
+    {
+        return visit_storage([](const auto& storage) -> const_pointer { return storage.data(); });
+    }
+
+    constexpr iterator begin() noexcept { return data(); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return data(); }
+    constexpr iterator end() noexcept { return std::next(begin(), as_difference(size())); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return std::next(cbegin(), as_difference(size()));
+    }
+
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator{cend()};
+    }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator{cbegin()};
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    /**
+     * The number of elements that fit without borrowing (another) block from the arena.
+     */
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept
+    {
+        return uses_arena() ? ArenaType::block_capacity() : INLINE_CAPACITY;
+    }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return visit_storage([](const auto& storage) { return storage.size(); });
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    template <std::size_t INLINE_CAPACITY_2, typename ArenaType2, typename CheckingType2>
+    constexpr bool operator==(
+        const FixedInplaceVector<T, INLINE_CAPACITY_2, ArenaType2, CheckingType2>& other) const
+    {
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    [[nodiscard]] constexpr ArenaType* arena() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+    }
+    [[nodiscard]] constexpr BlockIndexType block_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_;
+    }
+    [[nodiscard]] constexpr const InlineStorage& inline_storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_inline_storage_;
+    }
+    constexpr InlineStorage& inline_storage()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_inline_storage_;
+    }
+    [[nodiscard]] constexpr const typename ArenaType::Block& arena_block() const
+    {
+        return arena()->block_at(block_index());
+    }
+    constexpr typename ArenaType::Block& arena_block() { return arena()->block_at(block_index()); }
+
+    explicit constexpr FixedInplaceVector(ArenaType* arena) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_inline_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_{arena}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_{NO_BLOCK}
+    {
+    }
+
+    // Calls `func` with whichever FixedVector currently holds the elements
+    template <typename Func>
+    constexpr decltype(auto) visit_storage(Func&& func)
+    {
+        if (uses_arena())
+        {
+            return func(arena_block());
+        }
+        return func(inline_storage());
+    }
+    template <typename Func>
+    constexpr decltype(auto) visit_storage(Func&& func) const
+    {
+        if (uses_arena())
+        {
+            return func(arena_block());
+        }
+        return func(inline_storage());
+    }
+
+    template <typename U>
+    constexpr void active_storage_push_back(U&& value)
+    {
+        visit_storage([&value](auto& storage) { storage.push_back(std::forward<U>(value)); });
+    }
+
+    template <typename... Args>
+    constexpr iterator emplace_at_index(const std::size_t index,
+                                        const std_transition::source_location& loc,
+                                        Args&&... args)
+    {
+        if (!uses_arena() && size() == INLINE_CAPACITY)
+        {
+            check_can_borrow_block(size() + 1, loc);
+            move_to_block_with(arena()->acquire(), index, std::forward<Args>(args)...);
+            return std::next(begin(), as_difference(index));
+        }
+        reserve(size() + 1, loc);
+        visit_storage(
+            [&](auto& storage)
+            {
+                storage.emplace(std::next(storage.cbegin(), as_difference(index)),
+                                std::forward<Args>(args)...);
+            });
+        return std::next(begin(), as_difference(index));
+    }
+
+    // Like `move_to_block()`, but also emplaces a new element at `index`. The new element is
+    // constructed first, as `args` may refer to one of the inline elements.
+    template <typename... Args>
+    constexpr void move_to_block_with(const std::size_t new_block_index,
+                                      const std::size_t index,
+                                      Args&&... args)
+    {
+        auto& block = arena()->block_at(new_block_index);
+        block.emplace_back(std::forward<Args>(args)...);
+        for (T& value : inline_storage())
+        {
+            block.push_back(std::move(value));
+        }
+        std::rotate(block.begin(),
+                    std::next(block.begin()),
+                    std::next(block.begin(), as_difference(index + 1)));
+        inline_storage().clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_ =
+            static_cast<BlockIndexType>(new_block_index);
+    }
+
+    constexpr void move_to_block(const std::size_t new_block_index)
+    {
+        auto& block = arena()->block_at(new_block_index);
+        for (T& value : inline_storage())
+        {
+            block.push_back(std::move(value));
+        }
+        inline_storage().clear();
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_ =
+            static_cast<BlockIndexType>(new_block_index);
+    }
+
+    constexpr void release_block() noexcept
+    {
+        if (uses_arena())
+        {
+            arena()->release(block_index());
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_ = NO_BLOCK;
+        }
+    }
+
+    // Assumes `this` is empty and uses the inline buffer
+    constexpr void copy_from(const FixedInplaceVector& other)
+    {
+        reserve(other.size(), std_transition::source_location::current());
+        visit_storage(
+            [&other](auto& storage)
+            { storage.insert(storage.cend(), other.cbegin(), other.cend()); });
+    }
+    // Assumes `this` is empty and uses the inline buffer
+    constexpr void steal_from(FixedInplaceVector& other) noexcept
+    {
+        if (other.uses_arena())
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_ = other.block_index();
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_block_index_ = NO_BLOCK;
+            return;
+        }
+        inline_storage() = std::move(other.inline_storage());
+        other.inline_storage().clear();
+    }
+
+    static constexpr difference_type as_difference(const std::size_t value)
+    {
+        return static_cast<difference_type>(value);
+    }
+
+    [[nodiscard]] constexpr std::size_t index_of(const const_iterator it,
+                                                 const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(cbegin() <= it && it <= cend()))
+        {
+            Checking::invalid_argument("iterators exceed container range", loc);
+        }
+        return static_cast<std::size_t>(std::distance(cbegin(), it));
+    }
+
+    constexpr void check_can_borrow_block(const size_type count,
+                                          const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(count <= static_max_size() && arena() != nullptr &&
+                                !arena()->full()))
+        {
+            Checking::length_error(count, loc);
+        }
+    }
+
+    constexpr void check_index(const size_type index,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+};
+
+template <typename T, std::size_t INLINE_CAPACITY, typename ArenaType, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedInplaceVector<T, INLINE_CAPACITY, ArenaType, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename T,
+          std::size_t INLINE_CAPACITY,
+          typename ArenaType,
+          typename CheckingType,
+          typename Predicate>
+constexpr typename FixedInplaceVector<T, INLINE_CAPACITY, ArenaType, CheckingType>::size_type
+erase_if(FixedInplaceVector<T, INLINE_CAPACITY, ArenaType, CheckingType>& container,
+         Predicate predicate)
+{
+    const auto original_size = container.size();
+    container.erase(std::remove_if(container.begin(), container.end(), predicate),
+                    container.end());
+    return original_size - container.size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t INLINE_CAPACITY,
+          typename ArenaType,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedInplaceVector<T, INLINE_CAPACITY, ArenaType, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+};
+}  // namespace std
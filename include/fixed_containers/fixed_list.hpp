@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <type_traits>
@@ -401,7 +402,146 @@ public:
         return erase(pos, std::next(pos), loc);
     }
 
-    constexpr void clear() noexcept { destroy_range(begin(), end()); }
+    /**
+     * Transfers elements from `other` to just before `pos`.
+     * Within the same list, this only relinks indices and is O(1) per call. Across lists the
+     * elements live in different storages, so each transferred element is move-constructed
+     * exactly once (never copied).
+     */
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, other.cbegin(), other.cend(), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, it, std::next(it), loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, it, loc);
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList& other,
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const std::size_t insertion_point = index_of(pos);
+        const std::size_t first_index = other.index_of(first);
+        const std::size_t last_index = other.index_of(last);
+
+        if (this == &other)
+        {
+            list().splice_range_before_index(insertion_point, first_index, last_index);
+            return;
+        }
+
+        check_target_size(size() + static_cast<std::size_t>(std::distance(first, last)), loc);
+        for (std::size_t i = first_index; i != last_index;)
+        {
+            list().emplace_before_index_and_return_index(insertion_point,
+                                                         std::move(other.list().at(i)));
+            i = other.list().delete_at_and_return_next_index(i);
+        }
+    }
+    constexpr void splice(
+        const_iterator pos,
+        FixedList&& other,
+        const_iterator first,
+        const_iterator last,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        splice(pos, other, first, last, loc);
+    }
+
+    /**
+     * Merges the sorted `other` into this sorted list; `other` becomes empty. Elements of this
+     * list stay in place and elements of `other` are move-constructed exactly once. Stable, and
+     * O(size() + other.size()).
+     */
+    constexpr void merge(
+        FixedList& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, std::less<>{}, loc);
+    }
+    constexpr void merge(
+        FixedList&& other,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, std::less<>{}, loc);
+    }
+    template <typename Compare>
+    constexpr void merge(
+        FixedList& other,
+        Compare comp,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if (this == &other)
+        {
+            return;
+        }
+        check_target_size(size() + other.size(), loc);
+
+        std::size_t insertion_point = front_index();
+        for (std::size_t i = other.front_index(); i != other.end_index();)
+        {
+            T& value = other.list().at(i);
+            while (insertion_point != end_index() && !comp(value, list().at(insertion_point)))
+            {
+                insertion_point = list().next_of(insertion_point);
+            }
+            list().emplace_before_index_and_return_index(insertion_point, std::move(value));
+            i = other.list().delete_at_and_return_next_index(i);
+        }
+    }
+    template <typename Compare>
+    constexpr void merge(
+        FixedList&& other,
+        Compare comp,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        merge(other, comp, loc);
+    }
+
+    /**
+     * Stable sort that relinks indices instead of moving elements, so iterators and references
+     * remain valid. O(N log N) comparisons and no extra memory.
+     */
+    constexpr void sort() { sort(std::less<>{}); }
+    template <typename Compare>
+    constexpr void sort(Compare comp)
+    {
+        list().sort(comp);
+    }
+
+    constexpr void clear() noexcept { list().clear(); }
+
+    /**
+     * Moves the elements so that they occupy the first size() slots of the storage in list order,
+     * restoring memory locality after long runs of insertions and erasures.
+     * Invalidates all iterators and references.
+     */
+    constexpr void compact() noexcept { list().compact(); }
 
     constexpr iterator begin() noexcept { return create_iterator(front_index()); }
     [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
@@ -597,14 +737,6 @@ private:
 
     constexpr void destroy_at(std::size_t index) { list().delete_at_and_return_next_index(index); }
 
-    constexpr void destroy_range(iterator first, iterator last)
-    {
-        for (; first != last; ++first)
-        {
-            destroy_at(index_of(first));
-        }
-    }
-
     constexpr std::size_t index_of(const_iterator pos)
     {
         const auto& ref = pos.template private_reference_provider<ReferenceProvider<true>>();
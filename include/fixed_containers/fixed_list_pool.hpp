@@ -0,0 +1,854 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/int_math.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_list_pool_detail
+{
+// Same layout idea as FixedDoublyLinkedListBase, but with one sentinel per list. Sentinels live
+// after the MAXIMUM_SIZE node entries, so the sentinel of list `i` is at `MAXIMUM_SIZE + i`.
+// Each node also records the list it is in, so that list can be checked in O(1).
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT>
+class FixedListPoolArenaBase
+{
+    using StorageType = FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>;
+    static_assert(IsFixedIndexBasedBulkStorage<StorageType>);
+    using ChainEntryType = fixed_doubly_linked_list_detail::LinkedListIndices<std::size_t>;
+    using ChainType = std::array<ChainEntryType, MAXIMUM_SIZE + LIST_COUNT>;
+    using SizesType = std::array<std::size_t, LIST_COUNT>;
+    using OwnersType =
+        std::array<int_math::SmallestUnsignedIntegralFor<LIST_COUNT - 1>, MAXIMUM_SIZE>;
+
+public:
+    static constexpr std::size_t sentinel_of(const std::size_t list_id)
+    {
+        return MAXIMUM_SIZE + list_id;
+    }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    StorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    ChainType IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+    SizesType IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_;
+    OwnersType IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+
+public:
+    constexpr FixedListPoolArenaBase() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+    {
+        reset_sentinels();
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr std::size_t size(const std::size_t list_id) const noexcept
+    {
+        return sizes()[list_id];
+    }
+    [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
+
+    constexpr void clear() noexcept
+    {
+        storage().clear();
+        reset_sentinels();
+        sizes().fill(0);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+    [[nodiscard]] constexpr const T& at(const std::size_t index) const
+    {
+        return storage().at(index);
+    }
+    constexpr T& at(const std::size_t index) { return storage().at(index); }
+
+    [[nodiscard]] constexpr std::size_t front_index(const std::size_t list_id) const
+    {
+        return next_of(sentinel_of(list_id));
+    }
+    [[nodiscard]] constexpr std::size_t back_index(const std::size_t list_id) const
+    {
+        return prev_of(sentinel_of(list_id));
+    }
+
+    template <typename... Args>
+    constexpr std::size_t emplace_before_index_and_return_index(const std::size_t list_id,
+                                                                const std::size_t idx,
+                                                                Args&&... args)
+    {
+        const std::size_t new_idx = storage().emplace_and_return_index(std::forward<Args>(args)...);
+        link_before(new_idx, idx);
+        set_owner(new_idx, list_id);
+        sizes()[list_id]++;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        return new_idx;
+    }
+
+    constexpr std::size_t delete_at_and_return_next_index(const std::size_t list_id,
+                                                          const std::size_t idx)
+    {
+        storage().delete_at_and_return_repositioned_index(idx);
+        unlink(idx);
+        sizes()[list_id]--;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+        return next_of(idx);
+    }
+
+    // Moves the node at `idx` from list `from_list_id` to just before `pos_index` in list
+    // `to_list_id`. Only links are rewritten.
+    constexpr void relink_before_index(const std::size_t to_list_id,
+                                       const std::size_t pos_index,
+                                       const std::size_t from_list_id,
+                                       const std::size_t idx)
+    {
+        if (pos_index == idx || pos_index == next_of(idx))
+        {
+            return;
+        }
+        unlink(idx);
+        link_before(idx, pos_index);
+        set_owner(idx, to_list_id);
+        sizes()[from_list_id]--;
+        sizes()[to_list_id]++;
+    }
+
+    // Moves all nodes of list `from_list_id` to just before `pos_index` in list `to_list_id`.
+    // Linear in the number of moved nodes, as each of them records its new list.
+    constexpr void relink_all_before_index(const std::size_t to_list_id,
+                                           const std::size_t pos_index,
+                                           const std::size_t from_list_id)
+    {
+        const std::size_t from_sentinel = sentinel_of(from_list_id);
+        if (to_list_id == from_list_id || next_of(from_sentinel) == from_sentinel)
+        {
+            return;
+        }
+        const std::size_t first = next_of(from_sentinel);
+        const std::size_t last = prev_of(from_sentinel);
+        next_of(from_sentinel) = from_sentinel;
+        prev_of(from_sentinel) = from_sentinel;
+
+        prev_of(first) = prev_of(pos_index);
+        next_of(prev_of(pos_index)) = first;
+        next_of(last) = pos_index;
+        prev_of(pos_index) = last;
+
+        for (std::size_t i = first; i != pos_index; i = next_of(i))
+        {
+            set_owner(i, to_list_id);
+        }
+        sizes()[to_list_id] += sizes()[from_list_id];
+        sizes()[from_list_id] = 0;
+    }
+
+    // The list that the node (or sentinel) at `idx` belongs to
+    [[nodiscard]] constexpr std::size_t list_id_of(const std::size_t idx) const
+    {
+        if (idx >= MAXIMUM_SIZE)
+        {
+            return idx - MAXIMUM_SIZE;
+        }
+        return owners().at(idx);
+    }
+
+public:
+    [[nodiscard]] constexpr const std::size_t& next_of(const std::size_t index) const
+    {
+        return chain().at(index).next;
+    }
+    [[nodiscard]] constexpr std::size_t& next_of(const std::size_t index)
+    {
+        return chain().at(index).next;
+    }
+
+    [[nodiscard]] constexpr const std::size_t& prev_of(const std::size_t index) const
+    {
+        return chain().at(index).prev;
+    }
+    [[nodiscard]] constexpr std::size_t& prev_of(const std::size_t index)
+    {
+        return chain().at(index).prev;
+    }
+
+private:
+    constexpr void reset_sentinels()
+    {
+        for (std::size_t list_id = 0; list_id < LIST_COUNT; list_id++)
+        {
+            next_of(sentinel_of(list_id)) = sentinel_of(list_id);
+            prev_of(sentinel_of(list_id)) = sentinel_of(list_id);
+        }
+    }
+
+    constexpr void link_before(const std::size_t idx, const std::size_t pos_index)
+    {
+        prev_of(idx) = prev_of(pos_index);
+        next_of(idx) = pos_index;
+        next_of(prev_of(pos_index)) = idx;
+        prev_of(pos_index) = idx;
+    }
+    constexpr void unlink(const std::size_t idx)
+    {
+        next_of(prev_of(idx)) = next_of(idx);
+        prev_of(next_of(idx)) = prev_of(idx);
+    }
+    constexpr void set_owner(const std::size_t idx, const std::size_t list_id)
+    {
+        owners().at(idx) = static_cast<typename OwnersType::value_type>(list_id);
+    }
+
+    [[nodiscard]] constexpr const StorageType& storage() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_;
+    }
+    constexpr StorageType& storage() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_; }
+
+    [[nodiscard]] constexpr const ChainType& chain() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+    }
+    constexpr ChainType& chain() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_; }
+
+    [[nodiscard]] constexpr const SizesType& sizes() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_;
+    }
+    constexpr SizesType& sizes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_; }
+
+    [[nodiscard]] constexpr const OwnersType& owners() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_;
+    }
+    constexpr OwnersType& owners() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_; }
+};
+
+}  // namespace fixed_containers::fixed_list_pool_detail
+
+namespace fixed_containers::fixed_list_pool_detail::specializations
+{
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT>
+class FixedListPoolArena : public FixedListPoolArenaBase<T, MAXIMUM_SIZE, LIST_COUNT>
+{
+    using Base = FixedListPoolArenaBase<T, MAXIMUM_SIZE, LIST_COUNT>;
+
+public:
+    // clang-format off
+    constexpr FixedListPoolArena() noexcept : Base() { }
+    // clang-format on
+
+    constexpr FixedListPoolArena(const FixedListPoolArena& other)
+        requires TriviallyCopyConstructible<T>
+    = default;
+    constexpr FixedListPoolArena(FixedListPoolArena&& other) noexcept
+        requires TriviallyMoveConstructible<T>
+    = default;
+    constexpr FixedListPoolArena& operator=(const FixedListPoolArena& other)
+        requires TriviallyCopyAssignable<T>
+    = default;
+    constexpr FixedListPoolArena& operator=(FixedListPoolArena&& other) noexcept
+        requires TriviallyMoveAssignable<T>
+    = default;
+
+    constexpr FixedListPoolArena(const FixedListPoolArena& other)
+      : FixedListPoolArena()
+    {
+        nontrivial_copy_impl(other);
+    }
+    constexpr FixedListPoolArena(FixedListPoolArena&& other) noexcept
+      : FixedListPoolArena()
+    {
+        nontrivial_move_impl(other);
+        // Consistent with FixedDoublyLinkedList
+        other.clear();
+    }
+    constexpr FixedListPoolArena& operator=(const FixedListPoolArena& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        this->clear();
+        nontrivial_copy_impl(other);
+        return *this;
+    }
+    constexpr FixedListPoolArena& operator=(FixedListPoolArena&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+        this->clear();
+        nontrivial_move_impl(other);
+        return *this;
+    }
+
+    constexpr ~FixedListPoolArena() noexcept { this->clear(); }
+
+private:
+    // Same approach as FixedDoublyLinkedList: keep every value at the same index and copy the
+    // links verbatim. Assumes the destination (`this`) is already clear of any values.
+    constexpr void nontrivial_copy_impl(const FixedListPoolArena& other)
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.copy_live_from(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_);
+    }
+    constexpr void nontrivial_move_impl(FixedListPoolArena& other)
+    {
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_chain_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_sizes_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_owners_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_.move_live_from(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_storage_);
+    }
+};
+
+template <TriviallyCopyable T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT>
+class FixedListPoolArena<T, MAXIMUM_SIZE, LIST_COUNT>
+  : public FixedListPoolArenaBase<T, MAXIMUM_SIZE, LIST_COUNT>
+{
+    using Base = FixedListPoolArenaBase<T, MAXIMUM_SIZE, LIST_COUNT>;
+
+public:
+    // clang-format off
+    constexpr FixedListPoolArena() noexcept : Base() { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_list_pool_detail::specializations
+
+namespace fixed_containers::fixed_list_pool_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT>
+using FixedListPoolArena =
+    fixed_list_pool_detail::specializations::FixedListPoolArena<T, MAXIMUM_SIZE, LIST_COUNT>;
+}  // namespace fixed_containers::fixed_list_pool_detail
+
+namespace fixed_containers
+{
+/**
+ * A family of `LIST_COUNT` doubly-linked lists that draw their nodes from a single arena of
+ * `MAXIMUM_SIZE` nodes. Capacity is shared: any one list can hold up to `MAXIMUM_SIZE` elements
+ * as long as the total across all lists does not exceed it. Lists are identified by an id in
+ * [0, LIST_COUNT), and moving an element between lists (`splice`) is an O(1) relink.
+ *
+ * Iterators of one list are valid for the lifetime of the element, including after the element
+ * is spliced into another list.
+ *
+ * Operations that take a list id and an iterator require the iterator to belong to that list.
+ * Every node records which list it is in, so this is checked in O(1).
+ *
+ * Properties:
+ *  - constexpr
+ *  - retains the properties of T (e.g. if T is trivially copyable, then so is FixedListPool<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedListPool
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "FixedListPool must have a non-const, non-volatile value_type");
+    static_assert(LIST_COUNT > 0, "FixedListPool must have at least one list");
+    using Checking = CheckingType;
+    using Arena = fixed_list_pool_detail::FixedListPoolArena<T, MAXIMUM_SIZE, LIST_COUNT>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using list_id_type = std::size_t;
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutableArena = std::conditional_t<IS_CONST, const Arena, Arena>;
+
+    private:
+        ConstOrMutableArena* arena_;
+        std::size_t current_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutableArena* const arena,
+                                    const std::size_t& current_index) noexcept
+          : arena_{arena}
+          , current_index_{current_index}
+        {
+        }
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{mutable_other.arena_, mutable_other.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept { current_index_ = arena_->next_of(current_index_); }
+        constexpr void recede() noexcept { current_index_ = arena_->prev_of(current_index_); }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            assert_or_abort(current_index_ < MAXIMUM_SIZE);
+            return arena_->at(current_index_);
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            assert_or_abort(arena_ == other.arena_);
+            return current_index_ == other.current_index_;
+        }
+
+        [[nodiscard]] constexpr std::size_t current_index() const { return current_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider<true>,
+                                           ReferenceProvider<false>,
+                                           CONSTNESS,
+                                           DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+    [[nodiscard]] static constexpr std::size_t static_list_count() noexcept { return LIST_COUNT; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Arena IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+
+public:
+    constexpr FixedListPool() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_{}
+    {
+    }
+
+    constexpr void push_back(
+        const list_id_type list_id,
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        arena().emplace_before_index_and_return_index(list_id, end_index(list_id), value);
+    }
+    constexpr void push_back(
+        const list_id_type list_id,
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        arena().emplace_before_index_and_return_index(
+            list_id, end_index(list_id), std::move(value));
+    }
+    template <class... Args>
+    constexpr reference emplace_back(const list_id_type list_id, Args&&... args)
+    {
+        check_list_id_and_not_full(list_id, std_transition::source_location::current());
+        const std::size_t index = arena().emplace_before_index_and_return_index(
+            list_id, end_index(list_id), std::forward<Args>(args)...);
+        return arena().at(index);
+    }
+
+    constexpr void push_front(
+        const list_id_type list_id,
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        arena().emplace_before_index_and_return_index(list_id, front_index(list_id), value);
+    }
+    constexpr void push_front(
+        const list_id_type list_id,
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        arena().emplace_before_index_and_return_index(
+            list_id, front_index(list_id), std::move(value));
+    }
+    template <class... Args>
+    constexpr reference emplace_front(const list_id_type list_id, Args&&... args)
+    {
+        check_list_id_and_not_full(list_id, std_transition::source_location::current());
+        const std::size_t index = arena().emplace_before_index_and_return_index(
+            list_id, front_index(list_id), std::forward<Args>(args)...);
+        return arena().at(index);
+    }
+
+    constexpr void pop_back(
+        const list_id_type list_id,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(list_id, loc);
+        arena().delete_at_and_return_next_index(list_id, arena().back_index(list_id));
+    }
+    constexpr void pop_front(
+        const list_id_type list_id,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(list_id, loc);
+        arena().delete_at_and_return_next_index(list_id, front_index(list_id));
+    }
+
+    constexpr iterator insert(
+        const list_id_type list_id,
+        const_iterator pos,
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        check_belongs_to(list_id, pos, loc);
+        return create_iterator(
+            arena().emplace_before_index_and_return_index(list_id, index_of(pos), value));
+    }
+    constexpr iterator insert(
+        const list_id_type list_id,
+        const_iterator pos,
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id_and_not_full(list_id, loc);
+        check_belongs_to(list_id, pos, loc);
+        return create_iterator(arena().emplace_before_index_and_return_index(
+            list_id, index_of(pos), std::move(value)));
+    }
+    template <class... Args>
+    constexpr iterator emplace(const list_id_type list_id, const_iterator pos, Args&&... args)
+    {
+        check_list_id_and_not_full(list_id, std_transition::source_location::current());
+        check_belongs_to(list_id, pos, std_transition::source_location::current());
+        return create_iterator(arena().emplace_before_index_and_return_index(
+            list_id, index_of(pos), std::forward<Args>(args)...));
+    }
+
+    /**
+     * Erases the element at `pos`, which must belong to list `list_id`.
+     */
+    constexpr iterator erase(const list_id_type list_id,
+                             const_iterator pos,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        check_list_id(list_id, loc);
+        if (preconditions::test(pos != cend(list_id)))
+        {
+            Checking::invalid_argument("it != cend(), invalid parameter", loc);
+        }
+        check_belongs_to(list_id, pos, loc);
+        return create_iterator(arena().delete_at_and_return_next_index(list_id, index_of(pos)));
+    }
+
+    template <typename Predicate>
+    constexpr size_type remove_if(const list_id_type list_id, Predicate predicate)
+    {
+        check_list_id(list_id, std_transition::source_location::current());
+        size_type removed_counter = 0;
+        for (std::size_t i = front_index(list_id); i != end_index(list_id);)
+        {
+            if (predicate(arena().at(i)))
+            {
+                i = arena().delete_at_and_return_next_index(list_id, i);
+                ++removed_counter;
+            }
+            else
+            {
+                i = arena().next_of(i);
+            }
+        }
+        return removed_counter;
+    }
+
+    /**
+     * Moves the element at `it` from list `from_list_id` to just before `pos` in list
+     * `to_list_id`. O(1): only links change, the element is neither copied nor moved and `it`
+     * stays valid. `it` must belong to list `from_list_id` and `pos` to list `to_list_id`.
+     */
+    constexpr void splice(
+        const list_id_type to_list_id,
+        const_iterator pos,
+        const list_id_type from_list_id,
+        const_iterator it,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id(to_list_id, loc);
+        check_list_id(from_list_id, loc);
+        if (preconditions::test(it != cend(from_list_id)))
+        {
+            Checking::invalid_argument("it != cend(), invalid parameter", loc);
+        }
+        check_belongs_to(to_list_id, pos, loc);
+        check_belongs_to(from_list_id, it, loc);
+        arena().relink_before_index(to_list_id, index_of(pos), from_list_id, index_of(it));
+    }
+    /**
+     * Moves all elements of list `from_list_id` to just before `pos` in list `to_list_id`. The
+     * elements are neither copied nor moved, but each records its new list, so this is linear in
+     * the size of list `from_list_id`. `pos` must belong to list `to_list_id`.
+     */
+    constexpr void splice(
+        const list_id_type to_list_id,
+        const_iterator pos,
+        const list_id_type from_list_id,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_list_id(to_list_id, loc);
+        check_list_id(from_list_id, loc);
+        check_belongs_to(to_list_id, pos, loc);
+        arena().relink_all_before_index(to_list_id, index_of(pos), from_list_id);
+    }
+
+    constexpr void clear(const list_id_type list_id,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        check_list_id(list_id, loc);
+        for (std::size_t i = front_index(list_id); i != end_index(list_id);)
+        {
+            i = arena().delete_at_and_return_next_index(list_id, i);
+        }
+    }
+    constexpr void clear() noexcept { arena().clear(); }
+
+    constexpr reference front(
+        const list_id_type list_id,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(list_id, loc);
+        return arena().at(front_index(list_id));
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const list_id_type list_id,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(list_id, loc);
+        return arena().at(front_index(list_id));
+    }
+    constexpr reference back(
+        const list_id_type list_id,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(list_id, loc);
+        return arena().at(arena().back_index(list_id));
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const list_id_type list_id,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(list_id, loc);
+        return arena().at(arena().back_index(list_id));
+    }
+
+    constexpr iterator begin(const list_id_type list_id) noexcept
+    {
+        return create_iterator(front_index(list_id));
+    }
+    [[nodiscard]] constexpr const_iterator begin(const list_id_type list_id) const noexcept
+    {
+        return cbegin(list_id);
+    }
+    [[nodiscard]] constexpr const_iterator cbegin(const list_id_type list_id) const noexcept
+    {
+        return create_const_iterator(front_index(list_id));
+    }
+    constexpr iterator end(const list_id_type list_id) noexcept
+    {
+        return create_iterator(end_index(list_id));
+    }
+    [[nodiscard]] constexpr const_iterator end(const list_id_type list_id) const noexcept
+    {
+        return cend(list_id);
+    }
+    [[nodiscard]] constexpr const_iterator cend(const list_id_type list_id) const noexcept
+    {
+        return create_const_iterator(end_index(list_id));
+    }
+
+    /**
+     * Returns a range over the given list, for use with range-based for loops and algorithms.
+     */
+    constexpr auto list(const list_id_type list_id) noexcept
+    {
+        return std::ranges::subrange(begin(list_id), end(list_id));
+    }
+    [[nodiscard]] constexpr auto list(const list_id_type list_id) const noexcept
+    {
+        return std::ranges::subrange(cbegin(list_id), cend(list_id));
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t list_count() const noexcept
+    {
+        return static_list_count();
+    }
+    // Total number of elements across all lists
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return arena().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] constexpr std::size_t size(const list_id_type list_id) const noexcept
+    {
+        return arena().size(list_id);
+    }
+    [[nodiscard]] constexpr bool empty(const list_id_type list_id) const noexcept
+    {
+        return size(list_id) == 0;
+    }
+
+private:
+    constexpr iterator create_iterator(const std::size_t index) noexcept
+    {
+        return iterator{ReferenceProvider<false>{std::addressof(arena()), index}};
+    }
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const std::size_t index) const noexcept
+    {
+        return const_iterator{ReferenceProvider<true>{std::addressof(arena()), index}};
+    }
+
+    static constexpr std::size_t index_of(const_iterator pos)
+    {
+        const auto& ref = pos.template private_reference_provider<ReferenceProvider<true>>();
+        return ref.current_index();
+    }
+
+    [[nodiscard]] constexpr std::size_t front_index(const list_id_type list_id) const
+    {
+        return arena().front_index(list_id);
+    }
+    [[nodiscard]] static constexpr std::size_t end_index(const list_id_type list_id)
+    {
+        return Arena::sentinel_of(list_id);
+    }
+
+    static constexpr void check_list_id(const list_id_type list_id,
+                                        const std_transition::source_location& loc)
+    {
+        if (preconditions::test(list_id < LIST_COUNT))
+        {
+            Checking::out_of_range(list_id, LIST_COUNT, loc);
+        }
+    }
+    constexpr void check_belongs_to(const list_id_type list_id,
+                                    const const_iterator pos,
+                                    const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(arena().list_id_of(index_of(pos)) == list_id))
+        {
+            Checking::invalid_argument("iterator does not belong to the given list", loc);
+        }
+    }
+    constexpr void check_list_id_and_not_full(const list_id_type list_id,
+                                              const std_transition::source_location& loc) const
+    {
+        check_list_id(list_id, loc);
+        if (preconditions::test(!arena().full()))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const list_id_type list_id,
+                                   const std_transition::source_location& loc) const
+    {
+        check_list_id(list_id, loc);
+        if (preconditions::test(!empty(list_id)))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+
+    [[nodiscard]] constexpr const Arena& arena() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_;
+    }
+    constexpr Arena& arena() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_arena_; }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t LIST_COUNT, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedListPool<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          typename CheckingType,
+          typename Predicate>
+constexpr typename FixedListPool<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>::size_type erase_if(
+    FixedListPool<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>& container,
+    const std::size_t list_id,
+    Predicate predicate)
+{
+    return container.remove_if(list_id, predicate);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LIST_COUNT,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedListPool<T, MAXIMUM_SIZE, LIST_COUNT, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -281,6 +281,13 @@ public:
 
     constexpr void clear() noexcept { tree().clear(); }
 
+    /**
+     * Moves the entries so that they occupy the first size() slots of the storage in key order
+     * and rebalances the tree, restoring memory locality after long runs of insertions and
+     * erasures. Invalidates all iterators and references.
+     */
+    constexpr void compact() noexcept { tree().compact(); }
+
     constexpr std::pair<iterator, bool> insert(
         const value_type& value,
         const std_transition::source_location& loc =
@@ -0,0 +1,351 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_mpmc_queue_detail
+{
+template <typename T>
+struct Slot
+{
+    // `position` when free for the producer of `position`, and `position + 1` once that producer
+    // has published its element
+    std::atomic<std::size_t> sequence;
+    optional_storage_detail::OptionalStorage<T> value;
+};
+}  // namespace fixed_containers::fixed_mpmc_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Bounded, lock-free queue for any number of producer and consumer threads, with the elements
+ * stored in place. Based on Dmitry Vyukov's bounded MPMC queue: each slot carries a sequence
+ * number, so producers and consumers only contend on their own position counter (each on its own
+ * cache line) and never wait for each other while the queue is neither full nor empty.
+ *
+ * `MAXIMUM_SIZE` must be a power of two, and at least 2. `try_push()` and `try_pop()` return false
+ * when the queue is full or empty; `push()` reports a full queue through the `CheckingType`
+ * instead. The bulk functions claim a run of consecutive slots with a single compare-exchange.
+ *
+ * Not copyable or movable.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedMpmcQueue
+{
+    static_assert(MAXIMUM_SIZE >= 2 && std::has_single_bit(MAXIMUM_SIZE),
+                  "MAXIMUM_SIZE must be a power of two, and at least 2");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+    using Checking = CheckingType;
+    using SlotType = fixed_mpmc_queue_detail::Slot<T>;
+    using Counter = std::atomic<std::size_t>;
+    static constexpr std::size_t INDEX_MASK = MAXIMUM_SIZE - 1;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:
+    alignas(memory::CACHE_LINE_SIZE) Counter IMPLEMENTATION_DETAIL_DO_NOT_USE_enqueue_position_;
+    alignas(memory::CACHE_LINE_SIZE) Counter IMPLEMENTATION_DETAIL_DO_NOT_USE_dequeue_position_;
+    alignas(memory::CACHE_LINE_SIZE) std::array<SlotType, MAXIMUM_SIZE>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+
+public:
+    FixedMpmcQueue() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_enqueue_position_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_dequeue_position_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{}
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            slot_at(i).sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    FixedMpmcQueue(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue(FixedMpmcQueue&&) noexcept = delete;
+    FixedMpmcQueue& operator=(const FixedMpmcQueue&) = delete;
+    FixedMpmcQueue& operator=(FixedMpmcQueue&&) noexcept = delete;
+
+    ~FixedMpmcQueue() noexcept
+        requires TriviallyDestructible<T>
+    = default;
+    ~FixedMpmcQueue() noexcept
+        requires NotTriviallyDestructible<T>
+    {
+        const std::size_t end = enqueue_position().load(std::memory_order_acquire);
+        for (std::size_t i = dequeue_position().load(std::memory_order_acquire); i != end; i++)
+        {
+            memory::destroy_at_address_of(value_at(slot_at(i)));
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * The number of elements. Only a snapshot when called while other threads are active.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        const std::size_t dequeue = dequeue_position().load(std::memory_order_acquire);
+        const std::size_t enqueue = enqueue_position().load(std::memory_order_acquire);
+        return (std::min)(enqueue - dequeue, MAXIMUM_SIZE);
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * Returns false, without constructing anything, if the queue is full.
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        std::size_t position = 0;
+        if (claim_for_producer(position, 1) == 0)
+        {
+            return false;
+        }
+        SlotType& slot = slot_at(position);
+        memory::construct_at_address_of(value_at(slot), std::forward<Args>(args)...);
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * Copies as many of `values` as there are consecutive free slots for, in order. Returns the
+     * number of elements pushed.
+     */
+    std::size_t try_push_n(const std::span<const value_type> values)
+    {
+        std::size_t position = 0;
+        const std::size_t count = claim_for_producer(position, values.size());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            SlotType& slot = slot_at(position + i);
+            memory::construct_at_address_of(value_at(slot), values[i]);
+            slot.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * Same as `try_push()`, but a full queue is reported to the `CheckingType`.
+     */
+    void push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const bool pushed = try_push(value);
+        if (preconditions::test(pushed))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    void push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const bool pushed = try_push(std::move(value));
+        if (preconditions::test(pushed))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    /**
+     * Pushes all of `values`, in order. Other producers may interleave their elements. Running
+     * out of room is reported to the `CheckingType`, after pushing as many as fit; the rest are
+     * dropped.
+     */
+    void push_n(
+        std::span<const value_type> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        while (!values.empty())
+        {
+            const std::size_t pushed_count = try_push_n(values);
+            if (preconditions::test(pushed_count != 0))
+            {
+                Checking::length_error(MAXIMUM_SIZE + values.size(), loc);
+                return;
+            }
+            values = values.subspan(pushed_count);
+        }
+    }
+
+    /**
+     * Moves the front element into `out` and pops it. Returns false, leaving `out` untouched, if
+     * the queue is empty.
+     */
+    bool try_pop(value_type& out)
+    {
+        std::size_t position = 0;
+        if (claim_for_consumer(position, 1) == 0)
+        {
+            return false;
+        }
+        pop_into(position, out);
+        return true;
+    }
+
+    /**
+     * Moves up to `out.size()` consecutive elements from the front into `out`, in order, and pops
+     * them. Returns the number of elements popped.
+     */
+    std::size_t try_pop_n(const std::span<value_type> out)
+    {
+        std::size_t position = 0;
+        const std::size_t count = claim_for_consumer(position, out.size());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            pop_into(position + i, out[i]);
+        }
+        return count;
+    }
+
+private:
+    // Claims up to `wanted` consecutive positions, starting at `position`, whose slots are free.
+    // Returns the number of claimed positions, which is 0 if the queue is full.
+    std::size_t claim_for_producer(std::size_t& position, const std::size_t wanted)
+    {
+        return claim(enqueue_position(), 0, position, wanted);
+    }
+    // Claims up to `wanted` consecutive positions, starting at `position`, whose slots hold a
+    // published element. Returns the number of claimed positions, which is 0 if the queue is
+    // empty.
+    std::size_t claim_for_consumer(std::size_t& position, const std::size_t wanted)
+    {
+        return claim(dequeue_position(), 1, position, wanted);
+    }
+
+    // A slot is ready for position `p` when its sequence is `p + ready_offset`. The slots after
+    // `position` that are found ready cannot change state before the compare-exchange, since they
+    // would first have to be claimed through the same counter.
+    std::size_t claim(Counter& counter,
+                      const std::size_t ready_offset,
+                      std::size_t& position,
+                      const std::size_t wanted)
+    {
+        if (wanted == 0)
+        {
+            return 0;
+        }
+        position = counter.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const std::size_t sequence = slot_at(position).sequence.load(std::memory_order_acquire);
+            const auto lag = static_cast<std::ptrdiff_t>(sequence - (position + ready_offset));
+            if (lag == 0)
+            {
+                const std::size_t count =
+                    1 + count_ready_slots(position + 1, ready_offset, wanted - 1);
+                if (counter.compare_exchange_weak(
+                        position, position + count, std::memory_order_relaxed))
+                {
+                    return count;
+                }
+            }
+            else if (lag < 0)
+            {
+                return 0;  // Full for producers, empty for consumers
+            }
+            else
+            {
+                // Another thread claimed `position` in the meantime
+                position = counter.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t count_ready_slots(const std::size_t position,
+                                  const std::size_t ready_offset,
+                                  const std::size_t wanted)
+    {
+        const std::size_t limit = (std::min)(wanted, MAXIMUM_SIZE - 1);
+        std::size_t count = 0;
+        for (; count < limit; count++)
+        {
+            const std::size_t sequence =
+                slot_at(position + count).sequence.load(std::memory_order_acquire);
+            if (sequence != position + count + ready_offset)
+            {
+                break;
+            }
+        }
+        return count;
+    }
+
+    void pop_into(const std::size_t position, value_type& out)
+    {
+        SlotType& slot = slot_at(position);
+        T& entry = value_at(slot);
+        out = std::move(entry);
+        memory::destroy_at_address_of(entry);
+        // Free for the producer one lap later
+        slot.sequence.store(position + MAXIMUM_SIZE, std::memory_order_release);
+    }
+
+    // Accepts unwrapped positions
+    SlotType& slot_at(const std::size_t position)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[position & INDEX_MASK];
+    }
+    static T& value_at(SlotType& slot) { return optional_storage_detail::get(slot.value); }
+
+    [[nodiscard]] const Counter& enqueue_position() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_enqueue_position_;
+    }
+    Counter& enqueue_position() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_enqueue_position_; }
+    [[nodiscard]] const Counter& dequeue_position() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_dequeue_position_;
+    }
+    Counter& dequeue_position() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_dequeue_position_; }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+[[nodiscard]] bool is_full(const FixedMpmcQueue<T, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedMpmcQueue<T, MAXIMUM_SIZE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace fixed_containers::fixed_priority_queue_detail
+{
+// Parent and first child of the node at `index`, in an implicit heap where every node has `ARITY`
+// children
+template <std::size_t ARITY>
+[[nodiscard]] constexpr std::size_t parent_of(const std::size_t index)
+{
+    return (index - 1) / ARITY;
+}
+template <std::size_t ARITY>
+[[nodiscard]] constexpr std::size_t first_child_of(const std::size_t index)
+{
+    return (index * ARITY) + 1;
+}
+}  // namespace fixed_containers::fixed_priority_queue_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity priority queue with the same semantics as `std::priority_queue`: `top()` is the
+ * greatest element according to `Compare`, so `std::greater<T>` gives a min-queue.
+ *
+ * The elements are stored in a `FixedVector`, as an implicit heap where every node has `ARITY`
+ * children. A wider heap is shallower, so `push()` does fewer comparisons, and the children of a
+ * node are adjacent in memory, so `pop()` touches fewer cache lines than with a binary heap.
+ *
+ * Construction from a range builds the heap in linear time (Floyd's algorithm) instead of
+ * pushing the elements one at a time.
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<T>,
+          std::size_t ARITY = 4,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedPriorityQueue
+{
+    static_assert(ARITY >= 2, "ARITY must be at least 2");
+
+public:
+    using container_type = FixedVector<T, MAXIMUM_SIZE, CheckingType>;
+    using value_compare = Compare;
+    using value_type = typename container_type::value_type;
+    using size_type = typename container_type::size_type;
+    using reference = typename container_type::reference;
+    using const_reference = typename container_type::const_reference;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    container_type IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+
+public:
+    constexpr FixedPriorityQueue()
+      : FixedPriorityQueue{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedPriorityQueue(const Compare& comparator)
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedPriorityQueue(InputIt first,
+                                 InputIt last,
+                                 const Compare& comparator = Compare{},
+                                 const std_transition::source_location& loc =
+                                     std_transition::source_location::current()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_data_{first, last, loc}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+    {
+        make_heap();
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return data().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr value_compare value_comp() const { return comparator(); }
+
+    [[nodiscard]] constexpr const_reference top(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        return data().front(loc);
+    }
+
+    constexpr void push(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(value, loc);
+        sift_up_back();
+    }
+    constexpr void push(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        data().push_back(std::move(value), loc);
+        sift_up_back();
+    }
+
+    template <class... Args>
+    constexpr void emplace(Args&&... args)
+    {
+        data().emplace_back(std::forward<Args>(args)...);
+        sift_up_back();
+    }
+
+    constexpr void pop(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        value_type last = std::move(data().back(loc));
+        data().pop_back(loc);
+        if (!empty())
+        {
+            sift_down(0, std::move(last));
+        }
+    }
+
+    /**
+     * Same result as `push(value)` followed by `pop()`, returning the popped element, but with a
+     * single sift and without needing room for the extra element. When `value` would be the new
+     * top, it is returned right away and the queue is left untouched.
+     */
+    constexpr value_type push_pop(value_type value)
+    {
+        if (empty() || !comparator()(value, data()[0]))
+        {
+            return value;
+        }
+        value_type old_top = std::move(data()[0]);
+        sift_down(0, std::move(value));
+        return old_top;
+    }
+
+    constexpr void clear() noexcept { data().clear(); }
+
+private:
+    static constexpr auto parent_of = fixed_priority_queue_detail::parent_of<ARITY>;
+    static constexpr auto first_child_of = fixed_priority_queue_detail::first_child_of<ARITY>;
+
+    constexpr void make_heap()
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+        // Sift down every node that has children, deepest first
+        for (std::size_t index = parent_of(size() - 1) + 1; index-- > 0;)
+        {
+            value_type value = std::move(data()[index]);
+            sift_down(index, std::move(value));
+        }
+    }
+
+    constexpr void sift_up_back()
+    {
+        std::size_t hole = size() - 1;
+        value_type value = std::move(data()[hole]);
+        while (hole > 0)
+        {
+            const std::size_t parent = parent_of(hole);
+            if (!comparator()(data()[parent], value))
+            {
+                break;
+            }
+            data()[hole] = std::move(data()[parent]);
+            hole = parent;
+        }
+        data()[hole] = std::move(value);
+    }
+
+    // Moves the hole at `hole` down, by moving its greatest child up, until `value` fits in it
+    constexpr void sift_down(std::size_t hole, value_type value)
+    {
+        const std::size_t count = size();
+        while (true)
+        {
+            const std::size_t first_child = first_child_of(hole);
+            if (first_child >= count)
+            {
+                break;
+            }
+            const std::size_t end_child = (std::min)(first_child + ARITY, count);
+            std::size_t greatest_child = first_child;
+            for (std::size_t child = first_child + 1; child < end_child; child++)
+            {
+                if (comparator()(data()[greatest_child], data()[child]))
+                {
+                    greatest_child = child;
+                }
+            }
+            if (!comparator()(value, data()[greatest_child]))
+            {
+                break;
+            }
+            data()[hole] = std::move(data()[greatest_child]);
+            hole = greatest_child;
+        }
+        data()[hole] = std::move(value);
+    }
+
+    [[nodiscard]] constexpr const container_type& data() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    }
+    constexpr container_type& data() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_data_; }
+    [[nodiscard]] constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+};
+
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t ARITY,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<
+    fixed_containers::FixedPriorityQueue<T, MAXIMUM_SIZE, Compare, ARITY, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -8,8 +8,10 @@
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <functional>
+#include <limits>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -47,6 +49,9 @@ protected:  // [WORKAROUND-1]
     using ValueType = V;
     static constexpr bool HAS_ASSOCIATED_VALUE = IsNotEmpty<V>;
     using TreeStorage = FixedRedBlackTreeStorage<K, V, MAXIMUM_SIZE, COMPACTNESS, StorageTemplate>;
+    // Clearing, copies and moves use the bulk operations of the storage when available.
+    // `compact()` requires them.
+    static constexpr bool HAS_BULK_STORAGE = IsFixedIndexBasedBulkStorage<TreeStorage>;
     using NodeType = typename TreeStorage::NodeType;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
@@ -85,7 +90,17 @@ public:
 
     constexpr void clear() noexcept
     {
-        delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
+        if constexpr (HAS_BULK_STORAGE)
+        {
+            // No need to unlink and rebalance, the storage visits the live nodes directly
+            tree_storage().clear();
+            set_root_index(NULL_INDEX);
+            set_size(0);
+        }
+        else
+        {
+            delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
+        }
     }
 
     constexpr void insert_node(const K& key) noexcept
@@ -202,6 +217,33 @@ public:
         return to_idx;
     }
 
+    // Renumbers the nodes so that an in-order traversal visits indices 0, 1, ..., size() - 1, then
+    // relinks them as a balanced tree. Restores memory locality after long runs of insertions and
+    // deletions. Invalidates all iterators and references.
+    constexpr void compact() noexcept
+        requires HAS_BULK_STORAGE
+    {
+        // Stash the in-order rank of every node in its left index. The successor is computed
+        // before overwriting, and it never needs the left index of an already visited node.
+        NodeIndex rank = 0;
+        for (NodeIndex i = index_of_min_at(); i != NULL_INDEX; ++rank)
+        {
+            const NodeIndex successor = index_of_successor_at(i);
+            tree_storage().set_left_index(i, rank);
+            i = successor;
+        }
+
+        tree_storage().compact([this](const std::size_t index)
+                               { return tree_storage().left_index(index); });
+
+        // A midpoint split keeps the depth of all leaves within one of each other. Coloring the
+        // deepest level red (unless it is complete) equalizes the black height of all paths.
+        const bool is_complete = std::has_single_bit(size() + 1);
+        const std::size_t red_level =
+            is_complete ? (std::numeric_limits<std::size_t>::max)() : std::bit_width(size()) - 1;
+        set_root_index(link_balanced_subtree(0, size(), NULL_INDEX, 0, red_level));
+    }
+
     [[nodiscard]] constexpr const NodeIndex& root_index() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
@@ -823,6 +865,27 @@ private:
         set_color(idx, COLOR_BLACK);
     }
 
+    // Links nodes [first, last) as a balanced subtree and returns the index of its root.
+    constexpr NodeIndex link_balanced_subtree(const NodeIndex first,
+                                              const NodeIndex last,
+                                              const NodeIndex parent,
+                                              const std::size_t level,
+                                              const std::size_t red_level)
+    {
+        if (first == last)
+        {
+            return NULL_INDEX;
+        }
+        const NodeIndex middle = first + ((last - first) / 2);
+        tree_storage().set_parent_index(middle, parent);
+        tree_storage().set_left_index(
+            middle, link_balanced_subtree(first, middle, middle, level + 1, red_level));
+        tree_storage().set_right_index(
+            middle, link_balanced_subtree(middle + 1, last, middle, level + 1, red_level));
+        tree_storage().set_color(middle, level == red_level ? COLOR_RED : COLOR_BLACK);
+        return middle;
+    }
+
     constexpr void fixup_repositioned_index(NodeIndex& index,
                                             const NodeIndex old_index,
                                             const NodeIndex new_index) const noexcept
@@ -834,6 +897,62 @@ private:
     }
 
 protected:  // [WORKAROUND-1]
+    // Copies the nodes of `other` to the same indices, so the links can be reused as-is. Without
+    // bulk storage operations, inserts the nodes one by one instead. Assumes `this` is empty.
+    constexpr void nontrivial_copy_impl(const FixedRedBlackTreeBase& other)
+    {
+        if constexpr (HAS_BULK_STORAGE)
+        {
+            tree_storage().copy_live_from(other.tree_storage());
+            set_root_index(other.root_index());
+            set_size(other.size());
+        }
+        else
+        {
+            for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
+                 i = other.index_of_successor_at(i))
+            {
+                const auto node = other.tree_storage_at(i);
+                NodeIndexAndParentIndex np_idxs = index_of_node_with_parent(node.key());
+                if constexpr (HAS_ASSOCIATED_VALUE)
+                {
+                    insert_if_not_present_at(np_idxs, node.key(), node.value());
+                }
+                else
+                {
+                    insert_if_not_present_at(np_idxs, node.key());
+                }
+            }
+        }
+    }
+    constexpr void nontrivial_move_impl(FixedRedBlackTreeBase& other)
+    {
+        if constexpr (HAS_BULK_STORAGE)
+        {
+            tree_storage().move_live_from(other.tree_storage());
+            set_root_index(other.root_index());
+            set_size(other.size());
+        }
+        else
+        {
+            for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
+                 i = other.index_of_successor_at(i))
+            {
+                auto node = other.tree_storage_at(i);
+                NodeIndexAndParentIndex np_idxs = index_of_node_with_parent(node.key());
+                if constexpr (HAS_ASSOCIATED_VALUE)
+                {
+                    insert_if_not_present_at(
+                        np_idxs, std::move(node.key()), std::move(node.value()));
+                }
+                else
+                {
+                    insert_if_not_present_at(np_idxs, std::move(node.key()));
+                }
+            }
+        }
+    }
+
     [[nodiscard]] constexpr const TreeStorage& tree_storage() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_;
@@ -893,43 +1012,15 @@ public:
         requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
     = default;
 
-    // TODO: Use O(N) algorithm. Do non-recursive
     constexpr FixedRedBlackTree(const FixedRedBlackTree& other)
       : FixedRedBlackTree()
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->nontrivial_copy_impl(other);
     }
     constexpr FixedRedBlackTree(FixedRedBlackTree&& other) noexcept
       : FixedRedBlackTree()
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->nontrivial_move_impl(other);
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
         other.clear();
@@ -942,20 +1033,7 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->nontrivial_copy_impl(other);
         return *this;
     }
     constexpr FixedRedBlackTree& operator=(FixedRedBlackTree&& other) noexcept
@@ -966,21 +1044,7 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->nontrivial_move_impl(other);
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
         // Both choices are fine, because the state of a moved object is intentionally unspecified
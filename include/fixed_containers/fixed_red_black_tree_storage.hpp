@@ -61,6 +61,9 @@ public:
                            CompactRedBlackTreeNode<K, V>,
                            DefaultRedBlackTreeNode<K, V>>;
     static constexpr bool HAS_ASSOCIATED_VALUE = NodeType::HAS_ASSOCIATED_VALUE;
+    // The bulk operations below are only available if the underlying storage provides them
+    static constexpr bool HAS_BULK_OPERATIONS =
+        IsFixedIndexBasedBulkStorage<StorageTemplate<NodeType, MAXIMUM_SIZE>>;
     using size_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::size_type;
     using difference_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::difference_type;
 
@@ -75,6 +78,33 @@ public:
 
     [[nodiscard]] constexpr bool full() const noexcept { return storage().full(); }
 
+    // Calls `func(index)` for every node, in index order.
+    template <class Func>
+    constexpr void for_each_live(Func&& func) const
+        requires HAS_BULK_OPERATIONS
+    {
+        storage().for_each_live(std::forward<Func>(func));
+    }
+
+    // Destroys all nodes without touching their links.
+    constexpr void clear() noexcept
+        requires HAS_BULK_OPERATIONS
+    {
+        storage().clear();
+    }
+
+    // Copies every node of `other` to the same index. Assumes `this` does not contain any node.
+    constexpr void copy_live_from(const FixedRedBlackTreeStorage& other)
+        requires HAS_BULK_OPERATIONS
+    {
+        storage().copy_live_from(other.storage());
+    }
+    constexpr void move_live_from(FixedRedBlackTreeStorage& other)
+        requires HAS_BULK_OPERATIONS
+    {
+        storage().move_live_from(other.storage());
+    }
+
     [[nodiscard]] constexpr RedBlackTreeNodeView<const FixedRedBlackTreeStorage> at(
         const NodeIndex& index) const
     {
@@ -148,6 +178,21 @@ public:
         return storage().delete_at_and_return_repositioned_index(index);
     }
 
+    // Moves every node to the slot given by `target_index_of`. See
+    // `FixedIndexBasedPoolStorage::compact()`. Node links are not updated.
+    template <class TargetIndexOf, class OnRelocate>
+    constexpr void compact(const TargetIndexOf& target_index_of, const OnRelocate& on_relocate)
+        requires HAS_BULK_OPERATIONS
+    {
+        storage().compact(target_index_of, on_relocate);
+    }
+    template <class TargetIndexOf>
+    constexpr void compact(const TargetIndexOf& target_index_of)
+        requires HAS_BULK_OPERATIONS
+    {
+        compact(target_index_of, [](const std::size_t, const std::size_t) {});
+    }
+
 private:
     [[nodiscard]] constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
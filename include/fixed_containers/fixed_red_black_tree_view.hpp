@@ -1,8 +1,10 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/int_math.hpp"
 
 #include <cstdint>
 #include <iterator>
@@ -264,13 +266,14 @@ public:
             {
                 const auto iov_array_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
                 const auto next_index_size_bytes = sizeof(std::size_t);
-                return iov_array_size_bytes + next_index_size_bytes;
+                const auto occupancy_size_bytes =
+                    fixed_index_based_storage_detail::slot_bitset_size_bytes(max_size_bytes_);
+                return iov_array_size_bytes + next_index_size_bytes + occupancy_size_bytes;
             }
 
             case StorageType::FIXED_INDEX_CONTIGUOUS:
-                const auto vector_size_bytes = sizeof(std::size_t);
                 const auto vector_data_size_bytes = storage_elem_size_bytes_ * max_size_bytes_;
-                return vector_size_bytes + vector_data_size_bytes;
+                return contiguous_vector_data_offset() + vector_data_size_bytes;
             }
 
             assert_or_abort(false);
@@ -300,11 +303,22 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            const auto* const array_ptr =
-                std::next(fixed_vector_ptr, static_cast<difference_type>(sizeof(std::size_t)));
+            const auto* const array_ptr = std::next(
+                fixed_vector_ptr, static_cast<difference_type>(contiguous_vector_data_offset()));
             return array_ptr;
         }
 
+        /**
+         * Calculate the offset of the array inside the storage's fixed vector. The vector's size
+         * is stored in the narrowest integer that can hold the capacity, and tree nodes are
+         * aligned at least as strictly as NodeIndex.
+         */
+        [[nodiscard]] std::size_t contiguous_vector_data_offset() const
+        {
+            return align_up(int_math::smallest_unsigned_integral_size_bytes_for(max_size_bytes_),
+                            alignof(NodeIndex));
+        }
+
         /**
          * Calculate the pointer to the storage pool's fixed vector and read the size value.
          * Only valid for storage type 'FIXED_INDEX_CONTIGUOUS'.
@@ -315,7 +329,17 @@ public:
             const auto* const bptr = reinterpret_cast<const std::byte*>(base_);
             const auto* const storage_ptr = bptr;
             const auto* const fixed_vector_ptr = storage_ptr;
-            return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            switch (int_math::smallest_unsigned_integral_size_bytes_for(max_size_bytes_))
+            {
+            case sizeof(std::uint8_t):
+                return *reinterpret_cast<const std::uint8_t*>(fixed_vector_ptr);
+            case sizeof(std::uint16_t):
+                return *reinterpret_cast<const std::uint16_t*>(fixed_vector_ptr);
+            case sizeof(std::uint32_t):
+                return *reinterpret_cast<const std::uint32_t*>(fixed_vector_ptr);
+            default:
+                return *reinterpret_cast<const std::size_t*>(fixed_vector_ptr);
+            }
         }
 
         /**
@@ -0,0 +1,312 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/optional_reference.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity slot map with maximum size that is declared at compile-time via
+ * template parameter. Values are kept densely packed in a `FixedVector`, so iteration is a linear
+ * scan over contiguous memory. Each value is addressed by a `GenerationalIndex` handle that stays
+ * valid until that value is erased, regardless of other insertions and erasures. Handles go
+ * through an indirection table (a `FixedIndexBasedGenerationalPoolStorage` of dense positions), so
+ * lookup is O(1) and stale handles are detected.
+ *
+ * Erasing moves the last value into the erased position, so iteration order is not stable and
+ * iterators are invalidated by erasure (handles are not).
+ *
+ * Properties:
+ *  - constexpr
+ *  - retains the properties of T (e.g. if T is trivially copyable, then so is FixedSlotMap<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedSlotMap
+{
+    static_assert(IsNotReference<T>, "References are not allowed");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "SlotMap must have a non-const, non-volatile value_type");
+    using Checking = CheckingType;
+    using Values = FixedVector<T, MAXIMUM_SIZE, CheckingType>;
+    // Handle -> dense position
+    using Slots = FixedIndexBasedGenerationalPoolStorage<std::size_t, MAXIMUM_SIZE>;
+    // Dense position -> handle index. Needed to patch the handle of the moved value on erase.
+    using SlotIndexes = FixedVector<std::size_t, MAXIMUM_SIZE>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using handle_type = GenerationalIndex;
+    using iterator = typename Values::iterator;
+    using const_iterator = typename Values::const_iterator;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Slots IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    Values IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    SlotIndexes IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_;
+
+public:
+    constexpr FixedSlotMap() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_values_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_{}
+    {
+    }
+
+    constexpr handle_type insert(
+        const value_type& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        values().push_back(value);
+        return register_back();
+    }
+    constexpr handle_type insert(
+        value_type&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        values().push_back(std::move(value));
+        return register_back();
+    }
+
+    template <class... Args>
+    constexpr handle_type emplace(Args&&... args)
+    {
+        check_not_full(std_transition::source_location::current());
+        values().emplace_back(std::forward<Args>(args)...);
+        return register_back();
+    }
+
+    /**
+     * Erases the value referred to by `handle`. Returns the number of erased values (0 or 1).
+     * The last value is moved into the erased position.
+     */
+    constexpr size_type erase(const handle_type& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return 0;
+        }
+        erase_at_dense_index(slots().at(handle));
+        return 1;
+    }
+    constexpr iterator erase(const_iterator pos,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(pos != cend()))
+        {
+            Checking::invalid_argument("it != cend(), invalid parameter", loc);
+        }
+        const auto dense_index = static_cast<std::size_t>(std::distance(cbegin(), pos));
+        erase_at_dense_index(dense_index);
+        return std::next(begin(), static_cast<difference_type>(dense_index));
+    }
+
+    /**
+     * Erases all values. All outstanding handles become invalid.
+     */
+    constexpr void clear() noexcept
+    {
+        for (const std::size_t slot_index : slot_indexes())
+        {
+            slots().delete_at_and_return_repositioned_index(slot_index);
+        }
+        slot_indexes().clear();
+        values().clear();
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type& handle) const noexcept
+    {
+        return slots().contains(handle);
+    }
+
+    constexpr reference at(const handle_type& handle,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_contains(handle, loc);
+        return values()[slots().at(handle)];
+    }
+    [[nodiscard]] constexpr const_reference at(
+        const handle_type& handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_contains(handle, loc);
+        return values()[slots().at(handle)];
+    }
+
+    constexpr reference operator[](const handle_type& handle) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(handle, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](const handle_type& handle) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(handle, std_transition::source_location::current());
+    }
+
+    constexpr OptionalReference<T> try_at(const handle_type& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<T>{values()[slots().at(handle)]};
+    }
+    [[nodiscard]] constexpr OptionalReference<const T> try_at(
+        const handle_type& handle) const noexcept
+    {
+        if (!contains(handle))
+        {
+            return std::nullopt;
+        }
+        return OptionalReference<const T>{values()[slots().at(handle)]};
+    }
+
+    /**
+     * Returns the handle of the value at the given iterator.
+     */
+    [[nodiscard]] constexpr handle_type handle_of(const_iterator pos) const noexcept
+    {
+        const auto dense_index = static_cast<std::size_t>(std::distance(cbegin(), pos));
+        return slots().handle_of(slot_indexes()[dense_index]);
+    }
+
+    constexpr iterator begin() noexcept { return values().begin(); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return values().cbegin(); }
+    constexpr iterator end() noexcept { return values().end(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return values().cend(); }
+
+    constexpr pointer data() noexcept { return values().data(); }
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return values().data(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return values().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+private:
+    constexpr handle_type register_back()
+    {
+        const std::size_t dense_index = values().size() - 1;
+        const handle_type handle = slots().emplace_and_return_handle(dense_index);
+        slot_indexes().push_back(handle.index);
+        return handle;
+    }
+
+    constexpr void erase_at_dense_index(const std::size_t dense_index)
+    {
+        const std::size_t last_dense_index = size() - 1;
+        slots().delete_at_and_return_repositioned_index(slot_indexes()[dense_index]);
+        values().erase_unordered(
+            std::next(values().cbegin(), static_cast<difference_type>(dense_index)));
+        slot_indexes().erase_unordered(
+            std::next(slot_indexes().cbegin(), static_cast<difference_type>(dense_index)));
+        if (dense_index != last_dense_index)
+        {
+            slots().at(slot_indexes()[dense_index]) = dense_index;
+        }
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_contains(const handle_type& handle,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(handle)))
+        {
+            Checking::invalid_argument("handle is stale or invalid", loc);
+        }
+    }
+
+    [[nodiscard]] constexpr const Slots& slots() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+    }
+    constexpr Slots& slots() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_; }
+    [[nodiscard]] constexpr const Values& values() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_;
+    }
+    constexpr Values& values() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_values_; }
+    [[nodiscard]] constexpr const SlotIndexes& slot_indexes() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_;
+    }
+    constexpr SlotIndexes& slot_indexes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_slot_indexes_; }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(const FixedSlotMap<T, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
+constexpr typename FixedSlotMap<T, MAXIMUM_SIZE, CheckingType>::size_type erase_if(
+    FixedSlotMap<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    const auto original_size = container.size();
+    for (auto it = container.begin(); it != container.end();)
+    {
+        if (predicate(*it))
+        {
+            // The last value is moved into `it`, so it needs to be visited again
+            it = container.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return original_size - container.size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedSlotMap<T, MAXIMUM_SIZE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
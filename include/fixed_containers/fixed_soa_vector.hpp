@@ -0,0 +1,812 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/iterator_utils.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/random_access_iterator.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/tuples.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __has_builtin(__builtin_dump_struct)
+#include "fixed_containers/reflection.hpp"
+#endif
+
+namespace fixed_containers
+{
+// The number of fields of T that `FixedSoAVector<T>` stores as separate columns. Found via
+// reflection where it is available (clang 15 or later); can be specialized for T otherwise.
+template <typename T>
+struct soa_field_count;
+
+template <typename T>
+inline constexpr std::size_t soa_field_count_v =  // NOLINT(readability-identifier-naming)
+    soa_field_count<T>::value;
+
+#if __has_builtin(__builtin_dump_struct)
+template <reflection::Reflectable T>
+struct soa_field_count<T> : std::integral_constant<std::size_t, reflection::field_count_of<T>()>
+{
+};
+#endif
+}  // namespace fixed_containers
+
+namespace fixed_containers::fixed_soa_vector_detail
+{
+// The fields of T, as a std::tuple of references
+template <typename T>
+using FieldReferences = decltype(tuples::as_tuple_view<soa_field_count_v<T>>(std::declval<T&>()));
+
+template <std::size_t INDEX, typename T>
+using FieldType = std::remove_reference_t<std::tuple_element_t<INDEX, FieldReferences<T>>>;
+
+// Copies the fields of an lvalue and moves the fields of an rvalue
+template <typename Source, typename Field>
+constexpr decltype(auto) forward_field(Field& field)
+{
+    if constexpr (std::is_lvalue_reference_v<Source>)
+    {
+        return std::as_const(field);
+    }
+    else
+    {
+        return std::move(field);
+    }
+}
+
+// One base class per column, so that the columns can be stored as plain members (which keeps the
+// properties of the field types, e.g. trivial copyability) while still being indexable.
+template <std::size_t INDEX, typename ColumnType>
+struct ColumnLeaf
+{
+    ColumnType IMPLEMENTATION_DETAIL_DO_NOT_USE_column_;
+};
+
+template <typename IndexSequence, typename... ColumnTypes>
+struct Columns;
+
+template <std::size_t... INDICES, typename... ColumnTypes>
+struct Columns<std::index_sequence<INDICES...>, ColumnTypes...>
+  : public ColumnLeaf<INDICES, ColumnTypes>...
+{
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename IndexSequence>
+struct ColumnsFor;
+
+template <typename T, std::size_t MAXIMUM_SIZE, std::size_t... INDICES>
+struct ColumnsFor<T, MAXIMUM_SIZE, std::index_sequence<INDICES...>>
+{
+    using type = Columns<std::index_sequence<INDICES...>,
+                         FixedVector<FieldType<INDICES, T>, MAXIMUM_SIZE>...>;
+};
+}  // namespace fixed_containers::fixed_soa_vector_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity vector that stores each field of T in its own contiguous array
+ * (structure-of-arrays), with maximum size that is declared at compile-time via template
+ * parameter. T must be an aggregate that is constexpr default constructible. The number of its
+ * fields is found via reflection, which relies on `__builtin_dump_struct()` (clang 15 or later);
+ * with other compilers, specialize `soa_field_count<T>`.
+ *
+ * Scanning a single field touches only that field's array, see `column()`. Elements are
+ * accessed via proxy references: `soa[i].get<&T::price>()` is a reference to one field,
+ * `soa[i].value()` materializes a T and `soa[i] = t` writes all fields. The iterators have
+ * `value_type` T and customize `iter_move()`/`iter_swap()`, so std::ranges algorithms such as
+ * `sort()` move the fields of the elements.
+ *
+ * Properties:
+ *  - constexpr
+ *  - retains the properties of the fields of T (e.g. if they are all trivially copyable, then so
+ *    is FixedSoAVector<T>)
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ */
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<T, MAXIMUM_SIZE>>
+class FixedSoAVector
+{
+    static_assert(requires { soa_field_count<T>::value; },
+                  "The field count of T must be known, see soa_field_count");
+    static_assert(ConstexprDefaultConstructible<T>, "T must be constexpr default constructible");
+    static_assert(Aggregate<T>, "T must be an aggregate");
+    static_assert(std::same_as<std::remove_cv_t<T>, T>,
+                  "SoAVector must have a non-const, non-volatile value_type");
+    using Checking = CheckingType;
+
+    static constexpr std::size_t FIELD_COUNT = soa_field_count_v<T>;
+    static_assert(FIELD_COUNT > 0, "T must have at least one field");
+
+    using FieldIndices = std::make_index_sequence<FIELD_COUNT>;
+    using Columns =
+        typename fixed_soa_vector_detail::ColumnsFor<T, MAXIMUM_SIZE, FieldIndices>::type;
+
+    template <std::size_t INDEX>
+    using Field = fixed_soa_vector_detail::FieldType<INDEX, T>;
+    template <std::size_t INDEX>
+    using Column = FixedVector<Field<INDEX>, MAXIMUM_SIZE>;
+
+    template <auto MEMBER_POINTER>
+    using MemberType = std::remove_reference_t<decltype(std::declval<T&>().*MEMBER_POINTER)>;
+
+    // Maps `&T::field` to the index of that field, by comparing addresses in a T instance
+    template <auto MEMBER_POINTER>
+        requires(std::is_member_object_pointer_v<decltype(MEMBER_POINTER)>)
+    static constexpr std::size_t column_index_of()
+    {
+        T instance{};
+        std::size_t result = FIELD_COUNT;
+        tuples::for_each_entry(
+            tuples::as_tuple_view<FIELD_COUNT>(instance),
+            [&instance, &result]<typename F>(std::size_t index, F& field)
+            {
+                if constexpr (std::same_as<F, MemberType<MEMBER_POINTER>>)
+                {
+                    if (std::addressof(field) == std::addressof(instance.*MEMBER_POINTER))
+                    {
+                        result = index;
+                    }
+                }
+            });
+        return result;
+    }
+
+    template <auto MEMBER_POINTER>
+    static constexpr std::size_t COLUMN_INDEX = column_index_of<MEMBER_POINTER>();
+
+public:
+    template <bool IS_CONST>
+    class ReferenceProxy
+    {
+        friend class FixedSoAVector;
+        friend class ReferenceProxy<!IS_CONST>;
+        using ConstOrMutableSoAVector =
+            std::conditional_t<IS_CONST, const FixedSoAVector, FixedSoAVector>;
+
+    private:
+        ConstOrMutableSoAVector* soa_vector_;
+        std::size_t index_;
+
+        constexpr ReferenceProxy(ConstOrMutableSoAVector* const soa_vector,
+                                 const std::size_t index) noexcept
+          : soa_vector_{soa_vector}
+          , index_{index}
+        {
+        }
+
+    public:
+        constexpr ReferenceProxy(const ReferenceProxy&) noexcept = default;
+        constexpr ReferenceProxy(ReferenceProxy&&) noexcept = default;
+
+        template <bool IS_CONST_2>
+        constexpr ReferenceProxy(const ReferenceProxy<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProxy{mutable_other.soa_vector_, mutable_other.index_}
+        {
+        }
+
+        // Assignment writes through to the element, like assigning to a T&. Assigning from an
+        // rvalue proxy moves the fields out of the element it refers to, like assigning from
+        // `std::move(t)`.
+        constexpr const ReferenceProxy& operator=(const ReferenceProxy& other) const
+            requires(!IS_CONST)
+        {
+            soa_vector_->copy_element_from(index_, *other.soa_vector_, other.index_);
+            return *this;
+        }
+        constexpr const ReferenceProxy& operator=(ReferenceProxy&& other) const
+            requires(!IS_CONST)
+        {
+            soa_vector_->move_element_from(index_, *other.soa_vector_, other.index_);
+            return *this;
+        }
+        constexpr const ReferenceProxy& operator=(const T& value) const
+            requires(!IS_CONST)
+        {
+            soa_vector_->assign_at(index_, value);
+            return *this;
+        }
+        constexpr const ReferenceProxy& operator=(T&& value) const
+            requires(!IS_CONST)
+        {
+            soa_vector_->assign_at(index_, std::move(value));
+            return *this;
+        }
+
+        constexpr ~ReferenceProxy() noexcept = default;
+
+        /**
+         * Returns a reference to the given field of this element, e.g. `get<&T::price>()`.
+         */
+        template <auto MEMBER_POINTER>
+        [[nodiscard]] constexpr auto& get() const
+        {
+            return soa_vector_->template column_vector<COLUMN_INDEX<MEMBER_POINTER>>()[index_];
+        }
+
+        /**
+         * Materializes a copy of this element.
+         */
+        [[nodiscard]] constexpr T value() const { return soa_vector_->value_at(index_); }
+        explicit(false) constexpr operator T() const { return value(); }
+
+        // Swaps the elements, not the proxies, like swapping through two T&
+        friend constexpr void swap(const ReferenceProxy& lhs, const ReferenceProxy& rhs)
+            requires(!IS_CONST)
+        {
+            lhs.swap_with(rhs);
+        }
+
+    private:
+        constexpr void swap_with(const ReferenceProxy& other) const
+        {
+            soa_vector_->swap_element_with(index_, *other.soa_vector_, other.index_);
+        }
+    };
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = ReferenceProxy<false>;
+    using const_reference = ReferenceProxy<true>;
+
+private:
+    template <bool IS_CONST>
+    class ReferenceProvider
+    {
+        friend class ReferenceProvider<!IS_CONST>;
+        using ConstOrMutableSoAVector =
+            std::conditional_t<IS_CONST, const FixedSoAVector, FixedSoAVector>;
+
+    private:
+        ConstOrMutableSoAVector* soa_vector_;
+        std::size_t current_index_;
+
+    public:
+        using value_type = T;
+
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, 0}
+        {
+        }
+
+        constexpr ReferenceProvider(ConstOrMutableSoAVector* const soa_vector,
+                                    const std::size_t current_index) noexcept
+          : soa_vector_{soa_vector}
+          , current_index_{current_index}
+        {
+        }
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr ReferenceProvider(const ReferenceProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : ReferenceProvider{mutable_other.soa_vector_, mutable_other.current_index_}
+        {
+        }
+
+        constexpr void advance(const std::size_t n) noexcept { current_index_ += n; }
+        constexpr void recede(const std::size_t n) noexcept { current_index_ -= n; }
+
+        [[nodiscard]] constexpr ReferenceProxy<IS_CONST> get() const noexcept
+        {
+            return ReferenceProxy<IS_CONST>{soa_vector_, current_index_};
+        }
+
+        [[nodiscard]] constexpr T move_out() const
+        {
+            if constexpr (IS_CONST)
+            {
+                return soa_vector_->value_at(current_index_);
+            }
+            else
+            {
+                return soa_vector_->move_value_out_of(current_index_);
+            }
+        }
+        constexpr void swap_with(const ReferenceProvider& other) const
+            requires(!IS_CONST)
+        {
+            soa_vector_->swap_element_with(
+                current_index_, *other.soa_vector_, other.current_index_);
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            return current_index_ == other.current_index_;
+        }
+        template <bool IS_CONST2>
+        constexpr auto operator<=>(const ReferenceProvider<IS_CONST2>& other) const noexcept
+        {
+            return current_index_ <=> other.current_index_;
+        }
+
+        template <bool IS_CONST2>
+        constexpr std::ptrdiff_t operator-(const ReferenceProvider<IS_CONST2>& other) const
+        {
+            return static_cast<std::ptrdiff_t>(current_index_ - other.current_index_);
+        }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator = RandomAccessIterator<ReferenceProvider<true>,
+                                          ReferenceProvider<false>,
+                                          CONSTNESS,
+                                          DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Columns IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_;
+
+public:
+    constexpr FixedSoAVector() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_{}
+    {
+    }
+
+    constexpr FixedSoAVector(std::initializer_list<T> list,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+      : FixedSoAVector()
+    {
+        check_target_size(list.size(), loc);
+        for (const T& value : list)
+        {
+            push_back_unchecked(value);
+        }
+    }
+
+    /**
+     * Returns the given field of all elements as one contiguous span, e.g. `column<&T::price>()`.
+     */
+    template <auto MEMBER_POINTER>
+        requires(std::is_member_object_pointer_v<decltype(MEMBER_POINTER)>)
+    constexpr std::span<MemberType<MEMBER_POINTER>> column() noexcept
+    {
+        static_assert(COLUMN_INDEX<MEMBER_POINTER> < FIELD_COUNT,
+                      "The member pointer must refer to a direct field of T");
+        auto& col = column_vector<COLUMN_INDEX<MEMBER_POINTER>>();
+        return {col.data(), col.size()};
+    }
+    template <auto MEMBER_POINTER>
+        requires(std::is_member_object_pointer_v<decltype(MEMBER_POINTER)>)
+    [[nodiscard]] constexpr std::span<const MemberType<MEMBER_POINTER>> column() const noexcept
+    {
+        static_assert(COLUMN_INDEX<MEMBER_POINTER> < FIELD_COUNT,
+                      "The member pointer must refer to a direct field of T");
+        const auto& col = column_vector<COLUMN_INDEX<MEMBER_POINTER>>();
+        return {col.data(), col.size()};
+    }
+
+    constexpr void push_back(
+        const T& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        push_back_unchecked(value);
+    }
+    constexpr void push_back(
+        T&& value,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        push_back_unchecked(std::move(value));
+    }
+
+    constexpr void pop_back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        for_each_column([](auto& col) { col.pop_back(); });
+    }
+
+    /**
+     * Resizes the container to contain `count` elements. New elements have value-initialized
+     * fields.
+     */
+    constexpr void resize(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_target_size(count, loc);
+        for_each_column([count](auto& col) { col.resize(count); });
+    }
+
+    constexpr iterator erase(const_iterator first,
+                             const_iterator last,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(first <= last))
+        {
+            Checking::invalid_argument("first > last, range is invalid", loc);
+        }
+        if (preconditions::test(first >= cbegin() && last <= cend()))
+        {
+            Checking::invalid_argument("iterators exceed container range", loc);
+        }
+        const auto first_index = std::distance(cbegin(), first);
+        const auto last_index = std::distance(cbegin(), last);
+        for_each_column(
+            [first_index, last_index](auto& col)
+            {
+                col.erase(std::next(col.cbegin(), first_index),
+                          std::next(col.cbegin(), last_index));
+            });
+        return create_iterator(static_cast<std::size_t>(first_index));
+    }
+    constexpr iterator erase(const_iterator pos,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(pos != cend()))
+        {
+            Checking::invalid_argument("pos != cend(), invalid parameter", loc);
+        }
+        return erase(pos, std::next(pos), loc);
+    }
+
+    /**
+     * Erases the element at `pos` by moving the last element into its place, see
+     * `FixedVector::erase_unordered()`.
+     */
+    constexpr iterator erase_unordered(const_iterator pos,
+                                       const std_transition::source_location& loc =
+                                           std_transition::source_location::current()) noexcept
+    {
+        const std::size_t index = checked_index_of(pos, loc);
+        for_each_column(
+            [index](auto& col)
+            { col.erase_unordered(std::next(col.cbegin(), static_cast<difference_type>(index))); });
+        return create_iterator(index);
+    }
+
+    constexpr void clear() noexcept
+    {
+        for_each_column([](auto& col) { col.clear(); });
+    }
+
+    constexpr reference operator[](size_type index) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+    constexpr const_reference operator[](size_type index) const noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return at(index, std_transition::source_location::current());
+    }
+
+    constexpr reference at(size_type index,
+                           const std_transition::source_location& loc =
+                               std_transition::source_location::current()) noexcept
+    {
+        check_index(index, loc);
+        return reference{this, index};
+    }
+    [[nodiscard]] constexpr const_reference at(
+        size_type index,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_index(index, loc);
+        return const_reference{this, index};
+    }
+
+    constexpr reference front(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return reference{this, 0};
+    }
+    [[nodiscard]] constexpr const_reference front(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return const_reference{this, 0};
+    }
+    constexpr reference back(
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_empty(loc);
+        return reference{this, size() - 1};
+    }
+    [[nodiscard]] constexpr const_reference back(
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const
+    {
+        check_not_empty(loc);
+        return const_reference{this, size() - 1};
+    }
+
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(0);
+    }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(size());
+    }
+
+    constexpr reverse_iterator rbegin() noexcept { return create_reverse_iterator(size()); }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(size());
+    }
+    constexpr reverse_iterator rend() noexcept { return create_reverse_iterator(0); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(0);
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t capacity() const noexcept { return max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return column_vector<0>().size();
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    template <std::size_t MAXIMUM_SIZE_2, customize::SequenceContainerChecking CheckingType2>
+    constexpr bool operator==(const FixedSoAVector<T, MAXIMUM_SIZE_2, CheckingType2>& other) const
+    {
+        return equal_columns(other, FieldIndices{});
+    }
+
+private:
+    template <std::size_t INDEX>
+    [[nodiscard]] constexpr const Column<INDEX>& column_vector() const
+    {
+        return static_cast<const fixed_soa_vector_detail::ColumnLeaf<INDEX, Column<INDEX>>&>(
+                   IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_)
+            .IMPLEMENTATION_DETAIL_DO_NOT_USE_column_;
+    }
+    template <std::size_t INDEX>
+    constexpr Column<INDEX>& column_vector()
+    {
+        return static_cast<fixed_soa_vector_detail::ColumnLeaf<INDEX, Column<INDEX>>&>(
+                   IMPLEMENTATION_DETAIL_DO_NOT_USE_columns_)
+            .IMPLEMENTATION_DETAIL_DO_NOT_USE_column_;
+    }
+
+    template <typename Func>
+    constexpr void for_each_column(Func&& func)
+    {
+        [this, &func]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        { (func(column_vector<INDICES>()), ...); }(FieldIndices{});
+    }
+
+    template <typename U>
+    constexpr void push_back_unchecked(U&& value)
+    {
+        auto fields = tuples::as_tuple_view<FIELD_COUNT>(value);
+        [this, &fields]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            (column_vector<INDICES>().push_back(
+                 fixed_soa_vector_detail::forward_field<U>(std::get<INDICES>(fields))),
+             ...);
+        }(FieldIndices{});
+    }
+
+    template <typename U>
+    constexpr void assign_at(const std::size_t index, U&& value)
+    {
+        auto fields = tuples::as_tuple_view<FIELD_COUNT>(value);
+        [this, index, &fields]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            ((column_vector<INDICES>()[index] =
+                  fixed_soa_vector_detail::forward_field<U>(std::get<INDICES>(fields))),
+             ...);
+        }(FieldIndices{});
+    }
+
+    [[nodiscard]] constexpr T value_at(const std::size_t index) const
+    {
+        T result{};
+        auto fields = tuples::as_tuple_view<FIELD_COUNT>(result);
+        [this, index, &fields]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        { ((std::get<INDICES>(fields) = column_vector<INDICES>()[index]), ...); }(FieldIndices{});
+        return result;
+    }
+
+    [[nodiscard]] constexpr T move_value_out_of(const std::size_t index)
+    {
+        T result{};
+        auto fields = tuples::as_tuple_view<FIELD_COUNT>(result);
+        [this, index, &fields]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            ((std::get<INDICES>(fields) = std::move(column_vector<INDICES>()[index])), ...);
+        }(FieldIndices{});
+        return result;
+    }
+
+    constexpr void copy_element_from(const std::size_t index,
+                                     const FixedSoAVector& other,
+                                     const std::size_t other_index)
+    {
+        [this, index, &other, other_index]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            ((column_vector<INDICES>()[index] =
+                  other.template column_vector<INDICES>()[other_index]),
+             ...);
+        }(FieldIndices{});
+    }
+    constexpr void move_element_from(const std::size_t index,
+                                     FixedSoAVector& other,
+                                     const std::size_t other_index)
+    {
+        if (this == &other && index == other_index)
+        {
+            return;
+        }
+        [this, index, &other, other_index]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            ((column_vector<INDICES>()[index] =
+                  std::move(other.template column_vector<INDICES>()[other_index])),
+             ...);
+        }(FieldIndices{});
+    }
+
+    constexpr void swap_element_with(const std::size_t index,
+                                     FixedSoAVector& other,
+                                     const std::size_t other_index)
+    {
+        [this, index, &other, other_index]<std::size_t... INDICES>(std::index_sequence<INDICES...>)
+        {
+            (std::ranges::swap(column_vector<INDICES>()[index],
+                               other.template column_vector<INDICES>()[other_index]),
+             ...);
+        }(FieldIndices{});
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2, typename CheckingType2, std::size_t... INDICES>
+    [[nodiscard]] constexpr bool equal_columns(
+        const FixedSoAVector<T, MAXIMUM_SIZE_2, CheckingType2>& other,
+        std::index_sequence<INDICES...> /*unused*/) const
+    {
+        return ((column_vector<INDICES>() == other.template column_vector<INDICES>()) && ...);
+    }
+
+    template <typename, std::size_t, customize::SequenceContainerChecking>
+    friend class FixedSoAVector;
+
+    constexpr iterator create_iterator(const std::size_t index) noexcept
+    {
+        return iterator{ReferenceProvider<false>{this, index}};
+    }
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const std::size_t index) const noexcept
+    {
+        return const_iterator{ReferenceProvider<true>{this, index}};
+    }
+    constexpr reverse_iterator create_reverse_iterator(const std::size_t index) noexcept
+    {
+        return reverse_iterator{ReferenceProvider<false>{this, index}};
+    }
+    [[nodiscard]] constexpr const_reverse_iterator create_const_reverse_iterator(
+        const std::size_t index) const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider<true>{this, index}};
+    }
+
+    [[nodiscard]] constexpr std::size_t checked_index_of(
+        const const_iterator pos, const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(pos != cend()))
+        {
+            Checking::invalid_argument("pos != cend(), invalid parameter", loc);
+        }
+        return static_cast<std::size_t>(std::distance(cbegin(), pos));
+    }
+
+    static constexpr void check_target_size(size_type target_size,
+                                            const std_transition::source_location& loc)
+    {
+        if (preconditions::test(target_size <= MAXIMUM_SIZE))
+        {
+            Checking::length_error(target_size, loc);
+        }
+    }
+    constexpr void check_index(const size_type index,
+                               const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(index < size()))
+        {
+            Checking::out_of_range(index, size(), loc);
+        }
+    }
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_not_empty(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!empty()))
+        {
+            Checking::empty_container_access(loc);
+        }
+    }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
+constexpr typename FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase_if(
+    FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    using ConstReference = typename FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>::const_reference;
+    const auto original_size = container.size();
+    // Single pass, like std::remove_if: kept elements are moved over the removed ones, one field
+    // at a time
+    auto write_it = container.begin();
+    for (auto read_it = container.begin(); read_it != container.end(); ++read_it)
+    {
+        if (predicate(ConstReference{*read_it}))
+        {
+            continue;
+        }
+        if (write_it != read_it)
+        {
+            *write_it = std::move(*read_it);
+        }
+        ++write_it;
+    }
+    container.erase(write_it, container.end());
+    return original_size - container.size();
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T,
+          std::size_t MAXIMUM_SIZE,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedSoAVector<T, MAXIMUM_SIZE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+};
+}  // namespace std
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/optional_storage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Bounded, lock-free queue for exactly one producer thread and one consumer thread, with the
+ * elements stored in place.
+ *
+ * Only the producer may call `try_push()`, `try_emplace()` and `try_push_n()`, and only the
+ * consumer may call `try_pop()`, `try_pop_n()` and `consume()`. The head and tail counters are
+ * never wrapped; they are masked into the array, which requires `MAXIMUM_SIZE` to be a power of
+ * two. Each counter has its own cache line, shared with the owner's cached copy of the other
+ * counter, so the two threads only read each other's line when the queue looks full or empty.
+ * The batched functions publish all of their elements with a single store.
+ *
+ * Holds no pointers and never allocates, so it can be placed in memory shared between processes.
+ * Not copyable or movable.
+ */
+template <typename T, std::size_t MAXIMUM_SIZE>
+class FixedSpscQueue
+{
+    static_assert(std::has_single_bit(MAXIMUM_SIZE), "MAXIMUM_SIZE must be a power of two");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+    using OptionalT = optional_storage_detail::OptionalStorage<T>;
+    using Array = std::array<OptionalT, MAXIMUM_SIZE>;
+    using Counter = std::atomic<std::size_t>;
+    static constexpr std::size_t INDEX_MASK = MAXIMUM_SIZE - 1;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:
+    // Consumer side: the next element to pop, and the last observed tail
+    alignas(memory::CACHE_LINE_SIZE) Counter IMPLEMENTATION_DETAIL_DO_NOT_USE_head_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_tail_;
+    // Producer side: the next slot to push into, and the last observed head
+    alignas(memory::CACHE_LINE_SIZE) Counter IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_head_;
+    alignas(memory::CACHE_LINE_SIZE) Array IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
+
+public:
+    constexpr FixedSpscQueue() noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_head_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_tail_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_head_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_array_{}
+    {
+    }
+
+    FixedSpscQueue(const FixedSpscQueue&) = delete;
+    FixedSpscQueue(FixedSpscQueue&&) noexcept = delete;
+    FixedSpscQueue& operator=(const FixedSpscQueue&) = delete;
+    FixedSpscQueue& operator=(FixedSpscQueue&&) noexcept = delete;
+
+    ~FixedSpscQueue() noexcept
+        requires TriviallyDestructible<T>
+    = default;
+    ~FixedSpscQueue() noexcept
+        requires NotTriviallyDestructible<T>
+    {
+        const std::size_t tail = tail_counter().load(std::memory_order_acquire);
+        for (std::size_t i = head_counter().load(std::memory_order_acquire); i != tail; i++)
+        {
+            memory::destroy_at_address_of(unchecked_at(i));
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+
+    /**
+     * The number of elements. Only a snapshot when called while the other thread is active.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        // Load the head first: the tail can only grow in the meantime, so the difference never
+        // underflows. It can transiently overshoot if the consumer is also active.
+        const std::size_t head = head_counter().load(std::memory_order_acquire);
+        const std::size_t tail = tail_counter().load(std::memory_order_acquire);
+        return (std::min)(tail - head, MAXIMUM_SIZE);
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * Producer only. Returns false, without constructing anything, if the queue is full.
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const std::size_t tail = tail_counter().load(std::memory_order_relaxed);
+        if (free_count_for_producer(tail, 1) == 0)
+        {
+            return false;
+        }
+        memory::construct_at_address_of(unchecked_at(tail), std::forward<Args>(args)...);
+        tail_counter().store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * Producer only. Copies as many of `values` as there is room for, in order, and publishes them
+     * all at once. Trivially copyable types are copied with (at most) two memcpy calls. Returns
+     * the number of elements pushed.
+     */
+    std::size_t try_push_n(const std::span<const value_type> values)
+    {
+        const std::size_t tail = tail_counter().load(std::memory_order_relaxed);
+        const std::size_t count =
+            (std::min)(values.size(), free_count_for_producer(tail, values.size()));
+        const std::size_t first_index = tail & INDEX_MASK;
+        const std::size_t first_count = (std::min)(count, MAXIMUM_SIZE - first_index);
+        copy_into(first_index, values.first(first_count));
+        copy_into(0, values.subspan(first_count, count - first_count));
+        tail_counter().store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Consumer only. Moves the front element into `out` and pops it. Returns false, leaving `out`
+     * untouched, if the queue is empty.
+     */
+    bool try_pop(value_type& out)
+    {
+        const std::size_t head = head_counter().load(std::memory_order_relaxed);
+        if (ready_count_for_consumer(head, 1) == 0)
+        {
+            return false;
+        }
+        T& entry = unchecked_at(head);
+        out = std::move(entry);
+        memory::destroy_at_address_of(entry);
+        head_counter().store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer only. Moves up to `out.size()` elements from the front into `out`, in order, and
+     * pops them. Returns the number of elements popped.
+     */
+    std::size_t try_pop_n(const std::span<value_type> out)
+    {
+        value_type* out_it = out.data();
+        return consume(
+            out.size(),
+            [&out_it](const std::span<value_type> segment)
+            { out_it = std::move(segment.data(), std::to_address(segment.end()), out_it); });
+    }
+
+    /**
+     * Consumer only. Invokes `func` with up to `n` elements from the front as (at most) two
+     * contiguous spans, in order, and then pops them all at once. Returns the number of elements
+     * popped.
+     */
+    template <typename Func>
+    std::size_t consume(const std::size_t n, Func func)
+    {
+        const std::size_t head = head_counter().load(std::memory_order_relaxed);
+        const std::size_t count = (std::min)(n, ready_count_for_consumer(head, n));
+        const std::size_t first_index = head & INDEX_MASK;
+        const std::size_t first_count = (std::min)(count, MAXIMUM_SIZE - first_index);
+        const std::array<std::span<value_type>, 2> segments{span_at(first_index, first_count),
+                                                            span_at(0, count - first_count)};
+        for (const std::span<value_type> segment : segments)
+        {
+            if (!segment.empty())
+            {
+                func(segment);
+            }
+        }
+        if constexpr (NotTriviallyDestructible<T>)
+        {
+            for (const std::span<value_type> segment : segments)
+            {
+                std::destroy(segment.begin(), segment.end());
+            }
+        }
+        head_counter().store(head + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    // Only reloads the head when the cached one shows fewer than `wanted` free slots
+    std::size_t free_count_for_producer(const std::size_t tail, const std::size_t wanted)
+    {
+        std::size_t& cached_head = IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_head_;
+        if (MAXIMUM_SIZE - (tail - cached_head) < wanted)
+        {
+            cached_head = head_counter().load(std::memory_order_acquire);
+        }
+        return MAXIMUM_SIZE - (tail - cached_head);
+    }
+
+    // Only reloads the tail when the cached one shows fewer than `wanted` ready elements
+    std::size_t ready_count_for_consumer(const std::size_t head, const std::size_t wanted)
+    {
+        std::size_t& cached_tail = IMPLEMENTATION_DETAIL_DO_NOT_USE_cached_tail_;
+        if (cached_tail - head < wanted)
+        {
+            cached_tail = tail_counter().load(std::memory_order_acquire);
+        }
+        return cached_tail - head;
+    }
+
+    void copy_into(const std::size_t index, const std::span<const value_type> values)
+    {
+        if (values.empty())
+        {
+            return;
+        }
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(std::addressof(unchecked_at(index)), values.data(), values.size_bytes());
+        }
+        else
+        {
+            std::uninitialized_copy(
+                values.begin(), values.end(), std::addressof(unchecked_at(index)));
+        }
+    }
+
+    std::span<value_type> span_at(const std::size_t index, const std::size_t count)
+    {
+        static_assert(sizeof(OptionalT) == sizeof(T));
+        if (count == 0)
+        {
+            return {};
+        }
+        return {std::addressof(unchecked_at(index)), count};
+    }
+
+    // Accepts unwrapped counters
+    T& unchecked_at(const std::size_t counter)
+    {
+        return optional_storage_detail::get(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_array_[counter & INDEX_MASK]);
+    }
+
+    [[nodiscard]] const Counter& head_counter() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_head_;
+    }
+    Counter& head_counter() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_head_; }
+    [[nodiscard]] const Counter& tail_counter() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_;
+    }
+    Counter& tail_counter() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_; }
+};
+
+template <typename T, std::size_t MAXIMUM_SIZE>
+[[nodiscard]] bool is_full(const FixedSpscQueue<T, MAXIMUM_SIZE>& container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename T, std::size_t MAXIMUM_SIZE>
+struct tuple_size<fixed_containers::FixedSpscQueue<T, MAXIMUM_SIZE>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
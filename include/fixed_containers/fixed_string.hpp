@@ -7,10 +7,13 @@
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdlib>
+#include <ranges>
 #include <string_view>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -271,6 +274,19 @@ public:
         return vec().insert(pos, view.begin(), view.end(), loc);
     }
 
+    /**
+     * Inserts the characters of `range` before `pos`, see `FixedVector::insert_range()`.
+     */
+    template <std::ranges::input_range R>
+    constexpr iterator insert_range(
+        const_iterator pos,
+        R&& range,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const ScopedNullTermination guard{this, loc};
+        return vec().insert_range(pos, std::forward<R>(range), loc);
+    }
+
     constexpr iterator erase(
         const_iterator position,
         const std_transition::source_location& loc = std_transition::source_location::current())
@@ -329,6 +345,33 @@ public:
         return *this;
     }
 
+    /**
+     * Appends the characters of `range`. A contiguous range of `char` is copied with a single
+     * memcpy.
+     */
+    template <std::ranges::input_range R>
+    constexpr FixedString& append_range(
+        R&& range,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().append_range(std::forward<R>(range), loc);
+        null_terminate(loc);
+        return *this;
+    }
+
+    /**
+     * Appends `count` characters with indeterminate values and returns a pointer to the first of
+     * them, so they can be filled in directly (e.g. via memcpy or recv). The string stays
+     * null-terminated.
+     */
+    constexpr pointer append_uninitialized(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        const ScopedNullTermination guard{this, loc};
+        return vec().append_uninitialized(count, loc);
+    }
+
     constexpr FixedString& operator+=(CharT character)
     {
         return append(character, std_transition::source_location::current());
@@ -434,6 +477,18 @@ public:
         null_terminate(loc);
     }
 
+    /**
+     * Like `resize()`, but any new characters have indeterminate values instead of being zeroed.
+     * Meant for buffers that are about to be overwritten via `data()`.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        vec().resize_for_overwrite(count, loc);
+        null_terminate(loc);
+    }
+
 private:
     constexpr void null_terminate(std::size_t n)
     {
@@ -474,6 +529,24 @@ template <std::size_t MAXIMUM_LENGTH, typename CheckingType>
     return container.size() >= container.max_size();
 }
 
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, typename U>
+constexpr typename FixedString<MAXIMUM_LENGTH, CheckingType>::size_type erase(
+    FixedString<MAXIMUM_LENGTH, CheckingType>& container, const U& value)
+{
+    const auto original_size = container.size();
+    container.erase(std::remove(container.begin(), container.end(), value), container.end());
+    return original_size - container.size();
+}
+
+template <std::size_t MAXIMUM_LENGTH, typename CheckingType, typename Predicate>
+constexpr typename FixedString<MAXIMUM_LENGTH, CheckingType>::size_type erase_if(
+    FixedString<MAXIMUM_LENGTH, CheckingType>& container, Predicate predicate)
+{
+    const auto original_size = container.size();
+    container.erase(std::remove_if(container.begin(), container.end(), predicate), container.end());
+    return original_size - container.size();
+}
+
 /**
  * Construct a FixedString with its capacity being deduced from the number of items being passed.
  */
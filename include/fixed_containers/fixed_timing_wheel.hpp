@@ -0,0 +1,411 @@
+#pragma once
+
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sequence_container_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_timing_wheel_detail
+{
+template <typename Payload>
+struct Timer
+{
+    std::uint64_t deadline;
+    Payload payload;
+};
+}  // namespace fixed_containers::fixed_timing_wheel_detail
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity hierarchical timing wheel: timers are scheduled for a tick, and handed back by
+ * `for_each_expired()` once the wheel has been advanced to that tick.
+ *
+ * There are `LEVEL_COUNT` wheels of `SLOTS_PER_LEVEL` slots. A slot of level `l` covers
+ * `SLOTS_PER_LEVEL^l` ticks, so the wheel spans `SLOTS_PER_LEVEL^LEVEL_COUNT` ticks. Timers that
+ * are further away wait in the last slot of the last level until they come within range. Timers
+ * move one level down every time the wheel reaches the start of their slot, and fire from level
+ * 0.
+ *
+ * All slots are threaded through a single `FixedDoublyLinkedList`: every slot is represented by a
+ * marker node, and the timers of that slot are the nodes between its marker and the next one.
+ * Scheduling, cancelling and moving a timer to another slot only relink nodes, so they are O(1)
+ * and the handle of a timer (its node index plus a generation, see `GenerationalIndex`) stays
+ * valid until the timer fires or is cancelled. Advancing the wheel is O(1) per tick, plus the
+ * timers that move or fire.
+ *
+ * Ticks are abstract: the caller decides what a tick is (e.g. a millisecond) and feeds the
+ * current one to `for_each_expired()`.
+ */
+template <typename Payload,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LEVEL_COUNT = 4,
+          std::size_t SLOTS_PER_LEVEL = 64,
+          customize::SequenceContainerChecking CheckingType =
+              customize::SequenceContainerAbortChecking<Payload, MAXIMUM_SIZE>>
+class FixedTimingWheel
+{
+    static_assert(LEVEL_COUNT >= 1, "LEVEL_COUNT must be at least 1");
+    static_assert(SLOTS_PER_LEVEL >= 2 && std::has_single_bit(SLOTS_PER_LEVEL),
+                  "SLOTS_PER_LEVEL must be a power of two, and at least 2");
+
+    static constexpr std::size_t BITS_PER_LEVEL =
+        static_cast<std::size_t>(std::countr_zero(SLOTS_PER_LEVEL));
+    static_assert(BITS_PER_LEVEL * LEVEL_COUNT < std::numeric_limits<std::uint64_t>::digits,
+                  "The wheel must span less than 2^64 ticks");
+    static constexpr std::uint64_t SLOT_MASK = SLOTS_PER_LEVEL - 1;
+    static constexpr std::uint64_t SPAN = std::uint64_t{1} << (BITS_PER_LEVEL * LEVEL_COUNT);
+
+    // The marker nodes come first, so that slot `i` is marked by node `i`
+    static constexpr std::size_t SLOT_COUNT = LEVEL_COUNT * SLOTS_PER_LEVEL;
+    static constexpr std::size_t NODE_COUNT = SLOT_COUNT + MAXIMUM_SIZE;
+    static_assert(NODE_COUNT <= (std::numeric_limits<std::uint32_t>::max)(),
+                  "must be able to index all nodes with GenerationalIndex");
+
+    using Checking = CheckingType;
+    using TimerType = fixed_timing_wheel_detail::Timer<Payload>;
+    // Marker nodes are empty
+    using Nodes = fixed_doubly_linked_list_detail::FixedDoublyLinkedList<std::optional<TimerType>,
+                                                                         NODE_COUNT>;
+    // Bumped on every schedule and every removal, so it is odd while the node holds a timer
+    using Generations = std::array<std::uint32_t, NODE_COUNT>;
+
+public:
+    using payload_type = Payload;
+    using tick_type = std::uint64_t;
+    using size_type = std::size_t;
+    using handle_type = GenerationalIndex;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+    // Public like in the other containers. Not a structural type though, as the nodes hold
+    // std::optional
+public:
+    Nodes IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_;
+    Generations IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_;
+    tick_type IMPLEMENTATION_DETAIL_DO_NOT_USE_now_;
+
+public:
+    constexpr FixedTimingWheel() noexcept
+      : FixedTimingWheel{0}
+    {
+    }
+
+    /**
+     * Ticks up to and including `now` count as processed.
+     */
+    explicit constexpr FixedTimingWheel(const tick_type now) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_now_{now}
+    {
+        // A fresh pool hands out indices in order
+        for (std::size_t slot = 0; slot < SLOT_COUNT; slot++)
+        {
+            nodes().emplace_back_and_return_index(std::nullopt);
+        }
+    }
+
+public:
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return nodes().size() - SLOT_COUNT;
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * The last tick that was processed by `for_each_expired()`.
+     */
+    [[nodiscard]] constexpr tick_type now() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_now_;
+    }
+
+    /**
+     * Schedules `payload` to fire at tick `deadline`. A deadline that is not after `now()` fires
+     * on the next tick.
+     */
+    constexpr handle_type schedule(
+        const tick_type deadline,
+        const Payload& payload,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        return register_timer(nodes().emplace_after_index_and_return_index(
+            slot_of(deadline), TimerType{deadline, payload}));
+    }
+    constexpr handle_type schedule(
+        const tick_type deadline,
+        Payload&& payload,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_not_full(loc);
+        return register_timer(nodes().emplace_after_index_and_return_index(
+            slot_of(deadline), TimerType{deadline, std::move(payload)}));
+    }
+
+    /**
+     * Cancels the timer referred to by `handle`. Returns the number of cancelled timers (0 or 1):
+     * timers that already fired are ignored.
+     */
+    constexpr size_type cancel(const handle_type& handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return 0;
+        }
+        remove_and_return_next(handle.index);
+        return 1;
+    }
+
+    /**
+     * Moves the timer referred to by `handle` to tick `deadline`, without moving its payload.
+     * `handle` stays valid.
+     */
+    constexpr void reschedule(
+        const handle_type& handle,
+        const tick_type deadline,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        check_contains(handle, loc);
+        timer_at(handle.index).deadline = deadline;
+        move_to_slot(handle.index, slot_of(deadline));
+    }
+
+    /**
+     * Advances the wheel up to tick `now`, and calls `func(payload)` for every timer that fires,
+     * by tick. The timer is already removed when `func` is called, so `func` may move from the
+     * payload, and may schedule and cancel timers. Timers that `func` schedules for the tick that
+     * is being processed (or earlier) fire in the same call. Returns the number of timers that
+     * fired.
+     */
+    template <class Func>
+    constexpr size_type for_each_expired(const tick_type now, Func&& func)
+    {
+        size_type fired_count = 0;
+        while (this->now() < now)
+        {
+            if (empty())
+            {
+                // Nothing can be due in between
+                set_now(now);
+                break;
+            }
+            const tick_type tick = this->now() + 1;
+            cascade(tick);
+            fired_count += expire(tick, func);
+            set_now(tick);
+        }
+        return fired_count;
+    }
+
+    /**
+     * Cancels all timers. All outstanding handles become invalid.
+     */
+    constexpr void clear() noexcept
+    {
+        for (std::size_t index = nodes().front_index(); index != Nodes::NULL_INDEX;)
+        {
+            index = is_marker(index) ? nodes().next_of(index) : remove_and_return_next(index);
+        }
+    }
+
+    [[nodiscard]] constexpr bool contains(const handle_type& handle) const noexcept
+    {
+        return handle.index >= SLOT_COUNT && handle.index < NODE_COUNT &&
+               (handle.generation & 1U) == 1U && generation_at(handle.index) == handle.generation;
+    }
+
+    constexpr Payload& at(const handle_type& handle,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        check_contains(handle, loc);
+        return timer_at(handle.index).payload;
+    }
+    [[nodiscard]] constexpr const Payload& at(
+        const handle_type& handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_contains(handle, loc);
+        return timer_at(handle.index).payload;
+    }
+
+    [[nodiscard]] constexpr tick_type deadline_of(
+        const handle_type& handle,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        check_contains(handle, loc);
+        return timer_at(handle.index).deadline;
+    }
+
+private:
+    // The slot a timer with `deadline` belongs to, relative to the next tick to process
+    [[nodiscard]] constexpr std::size_t slot_of(const tick_type deadline) const
+    {
+        const tick_type next_tick = now() + 1;
+        tick_type due = (std::max)(deadline, next_tick);
+        if (due - next_tick >= SPAN)
+        {
+            // Out of range: park it in the slot of the furthest tick that is in range
+            due = next_tick + SPAN - 1;
+        }
+        const tick_type delta = due - next_tick;
+        const std::size_t level =
+            delta == 0 ? 0 : (static_cast<std::size_t>(std::bit_width(delta)) - 1) / BITS_PER_LEVEL;
+        return (level * SLOTS_PER_LEVEL) +
+               static_cast<std::size_t>((due >> (level * BITS_PER_LEVEL)) & SLOT_MASK);
+    }
+
+    // At the start of a slot of level `l`, its timers are all due within the next
+    // `SLOTS_PER_LEVEL^l` ticks and move to lower levels. Higher levels go first, as their timers
+    // may land in the slots of lower levels that start at the same tick.
+    constexpr void cascade(const tick_type tick)
+    {
+        for (std::size_t level = LEVEL_COUNT - 1; level > 0; level--)
+        {
+            const std::size_t shift = level * BITS_PER_LEVEL;
+            if ((tick & ((tick_type{1} << shift) - 1)) != 0)
+            {
+                continue;
+            }
+            const std::size_t slot =
+                (level * SLOTS_PER_LEVEL) + static_cast<std::size_t>((tick >> shift) & SLOT_MASK);
+            // Timers never move back into the slot that is being emptied
+            for (std::size_t index = first_timer_of(slot); index != Nodes::NULL_INDEX;
+                 index = first_timer_of(slot))
+            {
+                move_to_slot(index, slot_of(timer_at(index).deadline));
+            }
+        }
+    }
+
+    template <class Func>
+    constexpr size_type expire(const tick_type tick, Func& func)
+    {
+        const auto slot = static_cast<std::size_t>(tick & SLOT_MASK);
+        size_type fired_count = 0;
+        for (std::size_t index = first_timer_of(slot); index != Nodes::NULL_INDEX;
+             index = first_timer_of(slot))
+        {
+            Payload payload = std::move(timer_at(index).payload);
+            remove_and_return_next(index);
+            func(payload);
+            fired_count++;
+        }
+        return fired_count;
+    }
+
+    // Returns NULL_INDEX if the slot is empty
+    [[nodiscard]] constexpr std::size_t first_timer_of(const std::size_t slot) const
+    {
+        const std::size_t index = nodes().next_of(slot);
+        return index == Nodes::NULL_INDEX || is_marker(index) ? Nodes::NULL_INDEX : index;
+    }
+
+    constexpr void move_to_slot(const std::size_t index, const std::size_t slot)
+    {
+        nodes().splice_range_before_index(nodes().next_of(slot), index, nodes().next_of(index));
+    }
+
+    constexpr handle_type register_timer(const std::size_t index)
+    {
+        ++generation_at(index);
+        return {static_cast<std::uint32_t>(index), generation_at(index)};
+    }
+    constexpr std::size_t remove_and_return_next(const std::size_t index)
+    {
+        ++generation_at(index);
+        return nodes().delete_at_and_return_next_index(index);
+    }
+
+    [[nodiscard]] static constexpr bool is_marker(const std::size_t index)
+    {
+        return index < SLOT_COUNT;
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(size() < MAXIMUM_SIZE))
+        {
+            Checking::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+    constexpr void check_contains(const handle_type& handle,
+                                  const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(contains(handle)))
+        {
+            Checking::invalid_argument("handle is stale or invalid", loc);
+        }
+    }
+
+    [[nodiscard]] constexpr const TimerType& timer_at(const std::size_t index) const
+    {
+        return *nodes().at(index);
+    }
+    constexpr TimerType& timer_at(const std::size_t index) { return *nodes().at(index); }
+
+    [[nodiscard]] constexpr const Nodes& nodes() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_;
+    }
+    constexpr Nodes& nodes() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_nodes_; }
+    [[nodiscard]] constexpr std::uint32_t generation_at(const std::size_t index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_[index];
+    }
+    constexpr std::uint32_t& generation_at(const std::size_t index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_generations_[index];
+    }
+    constexpr void set_now(const tick_type now) { IMPLEMENTATION_DETAIL_DO_NOT_USE_now_ = now; }
+};
+
+template <typename Payload,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LEVEL_COUNT,
+          std::size_t SLOTS_PER_LEVEL,
+          typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedTimingWheel<Payload, MAXIMUM_SIZE, LEVEL_COUNT, SLOTS_PER_LEVEL, CheckingType>&
+        container)
+{
+    return container.size() >= MAXIMUM_SIZE;
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename Payload,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t LEVEL_COUNT,
+          std::size_t SLOTS_PER_LEVEL,
+          fixed_containers::customize::SequenceContainerChecking CheckingType>
+struct tuple_size<fixed_containers::FixedTimingWheel<Payload,
+                                                     MAXIMUM_SIZE,
+                                                     LEVEL_COUNT,
+                                                     SLOTS_PER_LEVEL,
+                                                     CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/algorithm.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/int_math.hpp"
 #include "fixed_containers/iterator_utils.hpp"
 #include "fixed_containers/memory.hpp"
 #include "fixed_containers/optional_storage.hpp"
@@ -13,10 +14,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <ranges>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_vector_detail
 {
@@ -149,8 +153,11 @@ private:
         }
     }
 
+    // The narrowest type that can hold MAXIMUM_SIZE, so small vectors stay small
+    using SizeStorageType = int_math::SmallestUnsignedIntegralFor<MAXIMUM_SIZE>;
+
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    SizeStorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
     Array IMPLEMENTATION_DETAIL_DO_NOT_USE_array_;
 
 public:
@@ -241,6 +248,69 @@ public:
         }
     }
 
+    /**
+     * Resizes the container to contain `count` elements, but leaves any new elements
+     * default-initialized (i.e. with indeterminate values for trivial types) instead of
+     * value-initialized. Meant for buffers that are about to be overwritten, e.g. via `data()`.
+     * During constant evaluation, new elements are value-initialized instead.
+     */
+    constexpr void resize_for_overwrite(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        requires(TriviallyDefaultConstructible<T> && TriviallyDestructible<T>)
+    {
+        check_target_size(count, loc);
+        if (std::is_constant_evaluated())
+        {
+            // Indeterminate values cannot be read during constant evaluation
+            for (std::size_t i = size(); i < count; i++)
+            {
+                place_at(i, T{});
+            }
+        }
+        set_size(count);
+    }
+
+    /**
+     * Appends `count` default-initialized elements, see `resize_for_overwrite()`. Returns a
+     * pointer to the first appended element.
+     */
+    constexpr pointer append_uninitialized(
+        size_type count,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+        requires(TriviallyDefaultConstructible<T> && TriviallyDestructible<T>)
+    {
+        const std::size_t old_size = size();
+        resize_for_overwrite(old_size + count, loc);
+        return std::next(data(), static_cast<difference_type>(old_size));
+    }
+
+    /**
+     * Appends the elements of `range` to the end of the container. A contiguous range of
+     * trivially copyable elements of the same type is copied with a single memcpy.
+     */
+    template <std::ranges::input_range R>
+    constexpr void append_range(
+        R&& range,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if constexpr (std::ranges::sized_range<R>)
+        {
+            const auto count = static_cast<std::size_t>(std::ranges::size(range));
+            check_target_size(size() + count, loc);
+            construct_n_at(end_index(), std::ranges::begin(range), count);
+            increment_size(count);
+            return;
+        }
+
+        for (auto&& entry : range)
+        {
+            check_not_full(loc);
+            emplace_at(end_index(), std::forward<decltype(entry)>(entry));
+            increment_size();
+        }
+    }
+
     /**
      * Appends the given element value to the end of the container.
      * Calling push_back on a full container is undefined.
@@ -315,16 +385,53 @@ public:
         InputIt last,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        return insert_internal(
-            typename std::iterator_traits<InputIt>::iterator_category{}, pos, first, last, loc);
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt>)
+        {
+            // The count is known up front even for single-pass iterators
+            return insert_n(pos, first, static_cast<std::size_t>(last - first), loc);
+        }
+        else
+        {
+            return insert_internal(typename std::iterator_traits<InputIt>::iterator_category{},
+                                   pos,
+                                   std::move(first),
+                                   std::move(last),
+                                   loc);
+        }
     }
     constexpr iterator insert(
         const_iterator pos,
         std::initializer_list<T> ilist,
         const std_transition::source_location& loc = std_transition::source_location::current())
     {
-        return insert_internal(
-            std::random_access_iterator_tag{}, pos, ilist.begin(), ilist.end(), loc);
+        return insert_n(pos, ilist.begin(), ilist.size(), loc);
+    }
+
+    /**
+     * Inserts the elements of `range` before `pos`. The elements after `pos` are shifted exactly
+     * once when the length of `range` can be determined up front (sized or forward ranges), and
+     * a contiguous range of trivially copyable elements of the same type is copied with a single
+     * memcpy.
+     */
+    template <std::ranges::input_range R>
+    constexpr iterator insert_range(
+        const_iterator pos,
+        R&& range,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>)
+        {
+            const auto count = static_cast<std::size_t>(std::ranges::distance(range));
+            return insert_n(pos, std::ranges::begin(range), count, loc);
+        }
+        else
+        {
+            return insert_internal(std::input_iterator_tag{},
+                                   pos,
+                                   std::ranges::begin(range),
+                                   std::ranges::end(range),
+                                   loc);
+        }
     }
 
     /**
@@ -407,7 +514,14 @@ public:
             destroy_range(write_start_it, std::next(write_start_it, entry_count_to_remove));
 
             // Do the relocation
-            algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            if constexpr (TriviallyRelocatable<T>)
+            {
+                trivially_relocate_entries(index_of(last), size(), index_of(first));
+            }
+            else
+            {
+                algorithm::uninitialized_relocate(read_start_it, read_end_it, write_start_it);
+            }
         }
         else
         {
@@ -432,6 +546,62 @@ public:
         return erase(pos, std::next(pos), loc);
     }
 
+    /**
+     * Erases the specified element by relocating the last element into its place. O(1), but
+     * does not preserve the order of the elements. Returns an iterator to the element that took
+     * the place of the erased one (or end(), if the last element was erased).
+     */
+    constexpr iterator erase_unordered(const_iterator pos,
+                                       const std_transition::source_location& loc =
+                                           std_transition::source_location::current()) noexcept
+    {
+        if (preconditions::test(pos >= cbegin() && pos < cend()))
+        {
+            Checking::invalid_argument("iterator must be within [begin(), end())", loc);
+        }
+
+        const std::size_t index = index_of(pos);
+        const std::size_t last_index = back_index();
+        if (index != last_index)
+        {
+            const iterator write_it = const_to_mutable_it(pos);
+            const iterator read_it = std::next(begin(), static_cast<difference_type>(last_index));
+            if (!std::is_constant_evaluated())
+            {
+                // Same as in `erase()`: relocation is only possible outside constant evaluation
+                destroy_at(index);
+                if constexpr (TriviallyRelocatable<T>)
+                {
+                    trivially_relocate_entries(last_index, last_index + 1, index);
+                }
+                else
+                {
+                    algorithm::uninitialized_relocate(read_it, std::next(read_it), write_it);
+                }
+                decrement_size();
+                return write_it;
+            }
+            *write_it = std::move(*read_it);
+        }
+
+        destroy_at(last_index);
+        decrement_size();
+        return std::next(begin(), static_cast<difference_type>(index));
+    }
+
+    /**
+     * Erases all elements satisfying `predicate`, without preserving the order of the remaining
+     * elements. Every removed element is replaced by one from the back. Returns the number of
+     * erased elements.
+     */
+    template <typename Predicate>
+    constexpr size_type erase_unordered_if(Predicate predicate)
+    {
+        const auto original_size = size();
+        erase(algorithm::unstable_remove_if(begin(), end(), predicate), end());
+        return original_size - size();
+    }
+
     /**
      * Erases all elements from the container. After this call, size() returns zero.
      */
@@ -515,6 +685,50 @@ public:
         return std::addressof(optional_storage_detail::get(*array().data()));
     }
 
+    /**
+     * Returns an iterator to the first element equal to `value`, or `end()`.
+     * For arithmetic and enum types, the elements are compared a block at a time, which
+     * compilers vectorize.
+     */
+    constexpr iterator find(const T& value)
+    {
+        return const_to_mutable_it(std::as_const(*this).find(value));
+    }
+    [[nodiscard]] constexpr const_iterator find(const T& value) const
+    {
+        if constexpr (algorithm::BlockComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const T* const last = std::next(data(), static_cast<difference_type>(size()));
+                const T* const found = algorithm::find_value(data(), last, value);
+                return std::next(cbegin(), std::distance(data(), found));
+            }
+        }
+        return std::find(cbegin(), cend(), value);
+    }
+
+    /**
+     * Returns the number of elements equal to `value`, see `find()`.
+     */
+    [[nodiscard]] constexpr size_type count(const T& value) const
+    {
+        if constexpr (algorithm::BlockComparable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const T* const last = std::next(data(), static_cast<difference_type>(size()));
+                return algorithm::count_value(data(), last, value);
+            }
+        }
+        return static_cast<size_type>(std::count(cbegin(), cend(), value));
+    }
+
+    /**
+     * Checks whether there is an element equal to `value`, see `find()`.
+     */
+    [[nodiscard]] constexpr bool contains(const T& value) const { return find(value) != cend(); }
+
     /**
      * Iterators
      */
@@ -597,6 +811,19 @@ private:
         increment_size(n);  // Increment now so iterators are all within valid range
 
         auto read_start_it = const_to_mutable_it(pos);
+        if constexpr (TriviallyRelocatable<T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                const std::size_t read_start_index = index_of(pos);
+                trivially_relocate_entries(read_start_index,
+                                           read_start_index +
+                                               static_cast<std::size_t>(value_count_to_move),
+                                           read_start_index + n);
+                return read_start_it;
+            }
+        }
+
         auto read_end_it = std::next(read_start_it, value_count_to_move);
         auto write_end_it =
             std::next(read_start_it, static_cast<std::ptrdiff_t>(n) + value_count_to_move);
@@ -605,6 +832,61 @@ private:
         return read_start_it;
     }
 
+    // Relocates the entries at [from_first_index, from_last_index) to start at `to_first_index`
+    // with a single memmove. Only usable outside of constant evaluation.
+    void trivially_relocate_entries(const std::size_t from_first_index,
+                                    const std::size_t from_last_index,
+                                    const std::size_t to_first_index) noexcept
+    {
+        OptionalT* const entries = array().data();
+        algorithm::trivially_relocate(
+            std::next(entries, static_cast<difference_type>(from_first_index)),
+            std::next(entries, static_cast<difference_type>(from_last_index)),
+            std::next(entries, static_cast<difference_type>(to_first_index)));
+    }
+
+    // Constructs `count` entries at [index, index + count), which must not hold live entries,
+    // from the elements starting at `first`.
+    template <typename InputIt>
+    constexpr void construct_n_at(const std::size_t index, InputIt first, const std::size_t count)
+    {
+        if constexpr (std::contiguous_iterator<InputIt> && TriviallyCopyable<T> &&
+                      std::same_as<std::remove_cv_t<std::iter_value_t<InputIt>>, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if (count > 0)
+                {
+                    pointer const destination =
+                        std::next(data(), static_cast<difference_type>(index));
+                    std::memcpy(static_cast<void*>(destination),
+                                static_cast<const void*>(std::to_address(first)),
+                                count * sizeof(T));
+                }
+                return;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i, ++first)
+        {
+            emplace_at(index + i, *first);
+        }
+    }
+
+    // Shifts the elements after `pos` exactly once, then constructs the new ones in the gap
+    template <typename InputIt>
+    constexpr iterator insert_n(const_iterator pos,
+                                InputIt first,
+                                const std::size_t entry_count_to_add,
+                                const std_transition::source_location& loc)
+    {
+        check_target_size(size() + entry_count_to_add, loc);
+        const std::size_t write_index = index_of(pos);
+        auto write_it = advance_all_after_iterator_by_n(pos, entry_count_to_add);
+        construct_n_at(write_index, std::move(first), entry_count_to_add);
+        return write_it;
+    }
+
     template <InputIterator InputIt>
     constexpr iterator insert_internal(std::forward_iterator_tag /*unused*/,
                                        const_iterator pos,
@@ -613,21 +895,15 @@ private:
                                        const std_transition::source_location& loc)
     {
         const auto entry_count_to_add = static_cast<std::size_t>(std::distance(first, last));
-        check_target_size(size() + entry_count_to_add, loc);
-
-        auto write_it = advance_all_after_iterator_by_n(pos, entry_count_to_add);
-        for (auto w_it = write_it; first != last; std::advance(first, 1), std::advance(w_it, 1))
-        {
-            memory::construct_at_address_of(*w_it, *first);
-        }
-        return write_it;
+        return insert_n(pos, first, entry_count_to_add, loc);
     }
 
-    template <InputIterator InputIt>
+    // The length is unknown up front: append everything, then rotate it into place
+    template <typename InputIt, typename Sentinel>
     constexpr iterator insert_internal(std::input_iterator_tag /*unused*/,
                                        const_iterator pos,
                                        InputIt first,
-                                       InputIt last,
+                                       Sentinel last,
                                        const std_transition::source_location& loc)
     {
         auto first_it = const_to_mutable_it(pos);
@@ -678,6 +954,10 @@ private:
     {
         return std::next(begin(), std::distance(cbegin(), const_it));
     }
+    [[nodiscard]] constexpr std::size_t index_of(const_iterator const_it) const
+    {
+        return static_cast<std::size_t>(std::distance(cbegin(), const_it));
+    }
 
     constexpr void check_not_full(const std_transition::source_location& loc) const
     {
@@ -704,17 +984,11 @@ private:
     }
     constexpr Array& array() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_array_; }
 
-    constexpr void increment_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ += n;
-    }
-    constexpr void decrement_size(const std::size_t n = 1)
-    {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ -= n;
-    }
+    constexpr void increment_size(const std::size_t n = 1) { set_size(size() + n); }
+    constexpr void decrement_size(const std::size_t n = 1) { set_size(size() - n); }
     constexpr void set_size(const std::size_t size)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = static_cast<SizeStorageType>(size);
     }
 
     [[nodiscard]] constexpr const T& unchecked_at(const std::size_t index) const
@@ -1012,6 +1286,13 @@ constexpr typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase_i
     return original_size - container.size();
 }
 
+template <typename T, std::size_t MAXIMUM_SIZE, typename CheckingType, typename Predicate>
+constexpr typename FixedVector<T, MAXIMUM_SIZE, CheckingType>::size_type erase_unordered_if(
+    FixedVector<T, MAXIMUM_SIZE, CheckingType>& container, Predicate predicate)
+{
+    return container.erase_unordered_if(predicate);
+}
+
 /**
  * Construct a FixedVector with its capacity being deduced from the number of items being passed.
  */
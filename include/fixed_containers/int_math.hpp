@@ -3,6 +3,10 @@
 #include "fixed_containers/assert_or_abort.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace fixed_containers::int_math
 {
@@ -98,4 +102,38 @@ constexpr T divide_integers_rounding_up(const T dividend, const T divisor)
     return ((dividend - static_cast<T>(1)) / divisor) + static_cast<T>(1);
 }
 
+/**
+ * The narrowest unsigned integral type that can represent every value in [0, MAXIMUM_VALUE].
+ * Used for the size counters of fixed-capacity containers, so that small containers do not
+ * carry 8 bytes of bookkeeping.
+ */
+template <std::size_t MAXIMUM_VALUE>
+using SmallestUnsignedIntegralFor = std::conditional_t<
+    MAXIMUM_VALUE <= (std::numeric_limits<std::uint8_t>::max)(),
+    std::uint8_t,
+    std::conditional_t<
+        MAXIMUM_VALUE <= (std::numeric_limits<std::uint16_t>::max)(),
+        std::uint16_t,
+        std::conditional_t<MAXIMUM_VALUE <= (std::numeric_limits<std::uint32_t>::max)(),
+                           std::uint32_t,
+                           std::size_t>>>;
+
+// Runtime counterpart of `SmallestUnsignedIntegralFor`, for the raw views.
+constexpr std::size_t smallest_unsigned_integral_size_bytes_for(const std::size_t maximum_value)
+{
+    if (maximum_value <= (std::numeric_limits<std::uint8_t>::max)())
+    {
+        return sizeof(std::uint8_t);
+    }
+    if (maximum_value <= (std::numeric_limits<std::uint16_t>::max)())
+    {
+        return sizeof(std::uint16_t);
+    }
+    if (maximum_value <= (std::numeric_limits<std::uint32_t>::max)())
+    {
+        return sizeof(std::uint32_t);
+    }
+    return sizeof(std::size_t);
+}
+
 }  // namespace fixed_containers::int_math
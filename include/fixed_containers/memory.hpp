@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace fixed_containers::memory
 {
+// Alignment used to keep data written by different threads on separate cache lines.
+// `std::hardware_destructive_interference_size` is not used because its value may change with
+// compiler flags, which would make it unsafe for types that are shared across translation units
+// (GCC warns about it with -Winterference-size).
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
 // Similar to https://en.cppreference.com/w/cpp/memory/construct_at
 // but uses references and correctly handles types that overload operator&
 //
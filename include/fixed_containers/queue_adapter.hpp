@@ -3,7 +3,12 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/source_location.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -100,6 +105,67 @@ public:
         IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.pop_front(loc);
     }
 
+    /**
+     * Pushes copies of all of `values`, in order, as if by calling `push()` for each of them.
+     * Requires the container to provide `push_back_n()`.
+     */
+    constexpr void push_n(
+        const std::span<const value_type> values,
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.push_back_n(values, loc);
+    }
+
+    /**
+     * Moves up to `out.size()` elements from the front into `out`, in order, and pops them.
+     * Returns the number of elements popped.
+     */
+    constexpr std::size_t pop_n(const std::span<value_type> out)
+    {
+        const std::size_t count = (std::min)(out.size(), size());
+        if (std::is_constant_evaluated())
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                out[i] = std::move(front());
+                pop();
+            }
+            return count;
+        }
+
+        value_type* out_it = out.data();
+        consume(count,
+                [&out_it](const std::span<value_type> segment)
+                { out_it = std::move(segment.data(), std::to_address(segment.end()), out_it); });
+        return count;
+    }
+
+    /**
+     * Invokes `func` with the first `n` elements (or all of them, if there are fewer) as (at most)
+     * two contiguous spans, in order, and then pops them. Returns the number of elements popped.
+     * Requires the container to provide `as_spans()` and `pop_front_n()`. Elements beyond the first
+     * one of each span cannot be accessed during constant evaluation.
+     */
+    template <typename Func>
+    constexpr std::size_t consume(const std::size_t n, Func func)
+    {
+        const std::size_t count = (std::min)(n, size());
+        std::size_t remaining = count;
+        for (const std::span<value_type> segment :
+             IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.as_spans())
+        {
+            const std::span<value_type> consumed =
+                segment.first((std::min)(remaining, segment.size()));
+            if (!consumed.empty())
+            {
+                func(consumed);
+            }
+            remaining -= consumed.size();
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_data_.pop_front_n(count);
+        return count;
+    }
+
     template <typename Container2>
     constexpr bool operator==(const QueueAdapter<Container2>& other) const
     {
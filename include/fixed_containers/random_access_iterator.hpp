@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 namespace fixed_containers
 {
@@ -20,6 +21,22 @@ concept RandomAccessEntryProvider = requires(P instance, P other, std::size_t un
     { instance - other } -> std::same_as<std::ptrdiff_t>;
 };
 
+namespace random_access_iterator_detail
+{
+// Entry providers that return proxies can declare the value_type the proxies stand for
+template <typename EntryProvider, typename ReturnedType>
+struct EntryValueType
+{
+    using type = std::remove_cvref_t<ReturnedType>;
+};
+template <typename EntryProvider, typename ReturnedType>
+    requires requires { typename EntryProvider::value_type; }
+struct EntryValueType<EntryProvider, ReturnedType>
+{
+    using type = typename EntryProvider::value_type;
+};
+}  // namespace random_access_iterator_detail
+
 template <RandomAccessEntryProvider ConstEntryProvider,
           RandomAccessEntryProvider MutableEntryProvider,
           IteratorConstness CONSTNESS,
@@ -58,7 +75,8 @@ class RandomAccessIterator
 
 public:
     using reference = ReturnedType;
-    using value_type = std::remove_cvref_t<reference>;
+    using value_type =
+        typename random_access_iterator_detail::EntryValueType<EntryProvider, ReturnedType>::type;
     using pointer =
         std::conditional_t<SAFE_LIFETIME, std::add_pointer_t<reference>, ArrowProxy<reference>>;
     using iterator = RandomAccessIterator;
@@ -240,6 +258,19 @@ public:
         return reference_provider_ == other.reference_provider_;
     }
 
+    // Entry providers that return proxies can customize how an entry is moved out and swapped,
+    // so that algorithms like std::ranges::sort move the elements and not the proxies
+    friend constexpr auto iter_move(const Self& it)
+        requires requires { it.reference_provider_.move_out(); }
+    {
+        return it.reference_provider_.move_out();
+    }
+    friend constexpr void iter_swap(const Self& lhs, const Self& rhs)
+        requires requires { lhs.reference_provider_.swap_with(rhs.reference_provider_); }
+    {
+        lhs.reference_provider_.swap_with(rhs.reference_provider_);
+    }
+
     [[nodiscard]] constexpr ReverseBase base() const noexcept
         requires(DIRECTION == IteratorDirection::REVERSE)
     {
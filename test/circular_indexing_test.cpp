@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <limits>
 
 namespace fixed_containers::circular_indexing
 {
@@ -68,4 +69,51 @@ TEST(CyclesAndInteger, DecrementIndexWithWraparound)
     }
 }
 
+TEST(CircularIndexing, WrapIndex)
+{
+    static_assert(3 == wrap_index<8>(11));
+    static_assert(0 == wrap_index<8>(16));
+    static_assert(0 == wrap_index<11>(11));
+    static_assert(8 == wrap_index<11>(30));
+    static_assert(0 == wrap_index<0>(5));
+}
+
+namespace
+{
+// Checks the compile-time capacity versions against the general ones
+template <std::size_t CAPACITY>
+constexpr bool matches_general_version(const std::size_t index, const std::size_t n)
+{
+    constexpr IntegerRange RANGE = IntegerRange::closed_open(0, CAPACITY);
+    return increment_index_with_wraparound<CAPACITY>(index, n) ==
+               increment_index_with_wraparound(RANGE, index, n).integer &&
+           decrement_index_with_wraparound<CAPACITY>(index, n) ==
+               decrement_index_with_wraparound(RANGE, index, n).integer;
+}
+}  // namespace
+
+TEST(CircularIndexing, IncrementAndDecrementWithCompileTimeCapacity)
+{
+    constexpr std::size_t HUGE_STEP = (std::numeric_limits<std::size_t>::max)() / 2;
+
+    // Power of two: masking
+    static_assert(1 == increment_index_with_wraparound<8>(5, 4));
+    static_assert(7 == decrement_index_with_wraparound<8>(2, 3));
+    static_assert(matches_general_version<8>(0, 0));
+    static_assert(matches_general_version<8>(7, 1));
+    static_assert(matches_general_version<8>(3, 21));
+    static_assert(matches_general_version<8>(5, HUGE_STEP));
+    static_assert(matches_general_version<1>(0, 3));
+
+    // Other capacities: conditional subtract
+    static_assert(2 == increment_index_with_wraparound<11>(9, 4));
+    static_assert(10 == decrement_index_with_wraparound<11>(2, 3));
+    static_assert(matches_general_version<11>(0, 0));
+    static_assert(matches_general_version<11>(10, 1));
+    static_assert(matches_general_version<11>(10, 10));
+    static_assert(matches_general_version<11>(3, 11));
+    static_assert(matches_general_version<11>(3, 30));
+    static_assert(matches_general_version<11>(5, HUGE_STEP));
+}
+
 }  // namespace fixed_containers::circular_indexing
@@ -18,6 +18,9 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <map>
+#include <random>
+#include <span>
 #include <type_traits>
 
 namespace fixed_containers
@@ -58,13 +61,11 @@ template <typename T, std::size_t MAXIMUM_SIZE>
 constexpr FixedCircularDeque<T, MAXIMUM_SIZE>& set_circular_deque_initial_state(
     FixedCircularDeque<T, MAXIMUM_SIZE>& circ_dq, std::size_t initial_starting_index)
 {
-    assert_or_abort(circ_dq.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_
-                        .IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.start ==
+    auto& deque = circ_dq.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_;
+    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ ==
                     STARTING_OFFSET_OF_TEST);
-    assert_or_abort(circ_dq.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_
-                        .IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.distance == 0);
-    circ_dq.IMPLEMENTATION_DETAIL_DO_NOT_USE_data_
-        .IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.start = initial_starting_index;
+    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ == 0);
+    deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ = initial_starting_index;
     return circ_dq;
 }
 
@@ -2225,6 +2226,26 @@ TEST(FixedCircularDeque, EraseIf)
     run_test(FixedCircularDequeInitialStateLastIndex{});
 }
 
+TEST(FixedCircularDeque, EraseUnorderedIf)
+{
+    auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 8>({0, 1, 2, 3, 4, 5, 6});
+            const std::size_t removed_count = fixed_containers::erase_unordered_if(
+                var, [](const int& entry) { return (entry % 2) == 0; });
+            assert_or_abort(4 == removed_count);
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 3>{5, 1, 3}));
+    };
+
+    run_test(FixedCircularDequeInitialStateFirstIndex{});
+    run_test(FixedCircularDequeInitialStateLastIndex{});
+}
+
 TEST(FixedCircularDeque, Front)
 {
     auto run_test = []<IsFixedCircularDequeFactory Factory>(Factory&&)
@@ -2313,6 +2334,271 @@ TEST(FixedCircularDeque, BackEmptyContainer)
     run_test(FixedCircularDequeInitialStateLastIndex{});
 }
 
+TEST(FixedCircularDeque, AsSpansAndLinearize)
+{
+    FixedCircularDeque<int, 4> var1{};
+    for (int i = 0; i < 6; i++)
+    {
+        var1.push_back(i);
+    }
+    // Overwrote the oldest two, so the elements wrap around the end of the storage
+    const auto spans1 = std::as_const(var1).as_spans();
+    EXPECT_TRUE(std::ranges::equal(spans1[0], std::array{2, 3}));
+    EXPECT_TRUE(std::ranges::equal(spans1[1], std::array{4, 5}));
+
+    const std::span<int> span1 = var1.linearize();
+    EXPECT_TRUE(std::ranges::equal(span1, std::array{2, 3, 4, 5}));
+    EXPECT_TRUE(var1.as_spans()[1].empty());
+
+    var1.push_back(6);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{3, 4, 5, 6}));
+}
+
+TEST(FixedCircularDeque, SequenceNumbers)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedCircularDeque<int, 3> var{};
+        for (int i = 0; i < 5; i++)
+        {
+            var.push_back(i * 10);
+        }
+        return var;
+    }();
+    static_assert(VAL1.front_sequence() == 2);
+    static_assert(VAL1.next_sequence() == 5);
+    static_assert(!VAL1.at_sequence(1).has_value());
+    static_assert(VAL1.at_sequence(2).value() == 20);
+    static_assert(VAL1.at_sequence(4).value() == 40);
+
+    FixedCircularDeque<int, 4> var1{};
+    EXPECT_EQ(0, var1.front_sequence());
+    EXPECT_EQ(0, var1.next_sequence());
+    EXPECT_DEATH((void)var1.at_sequence(0), "");
+
+    var1.push_back_n(std::array{0, 1, 2, 3, 4, 5});
+    EXPECT_EQ(2, var1.front_sequence());
+    EXPECT_EQ(6, var1.next_sequence());
+    var1.emplace_back(6);
+    var1.pop_front();
+    EXPECT_EQ(4, var1.front_sequence());
+    EXPECT_FALSE(var1.at_sequence(3).has_value());
+    EXPECT_EQ(4, var1.at_sequence(4).value());
+    var1.at_sequence(6).value() = 60;
+    EXPECT_EQ(60, var1.back());
+    EXPECT_DEATH((void)var1.at_sequence(7), "");
+
+    // Discarding every element keeps counting
+    var1.clear();
+    EXPECT_EQ(7, var1.front_sequence());
+    EXPECT_EQ(7, var1.next_sequence());
+    var1.assign({1, 2});
+    var1.assign({3, 4, 5, 6, 7});
+    EXPECT_EQ(10, var1.front_sequence());
+    EXPECT_EQ(4, var1.at_sequence(10).value());
+
+    // Elements that do not fit count as pushed and overwritten right away
+    const FixedCircularDeque<int, 3> var3{1, 2, 3, 4, 5};
+    EXPECT_EQ(2, var3.front_sequence());
+    EXPECT_EQ(3, var3.at_sequence(2).value());
+    const FixedCircularDeque<int, 4> var4(10, 7);
+    const std::array<int, 10> ten_values{7, 7, 7, 7, 7, 7, 7, 7, 7, 7};
+    const FixedCircularDeque<int, 4> var5(ten_values.begin(), ten_values.end());
+    EXPECT_EQ(6, var4.front_sequence());
+    EXPECT_EQ(var5.front_sequence(), var4.front_sequence());
+    FixedCircularDeque<int, 4> var6{};
+    var6.assign(10, 7);
+    EXPECT_EQ(6, var6.front_sequence());
+    var6.assign(3, 7);
+    EXPECT_EQ(10, var6.front_sequence());
+
+    // Copies carry the sequence numbers along
+    const FixedCircularDeque<int, 4> var2 = var1;
+    EXPECT_EQ(14, var2.next_sequence());
+    EXPECT_EQ(7, var2.at_sequence(13).value());
+}
+
+TEST(FixedCircularDeque, SequenceNumbersAfterEraseAtTheFront)
+{
+    FixedCircularDeque<int, 4> var1{10, 11, 12};
+    var1.erase(var1.cbegin());
+    EXPECT_EQ(1, var1.front_sequence());
+    EXPECT_FALSE(var1.at_sequence(0).has_value());
+    EXPECT_EQ(11, var1.at_sequence(1).value());
+    EXPECT_EQ(12, var1.at_sequence(2).value());
+
+    var1.push_back(13);
+    var1.erase(var1.cbegin(), std::next(var1.cbegin(), 2));
+    EXPECT_EQ(3, var1.front_sequence());
+    EXPECT_EQ(13, var1.at_sequence(3).value());
+}
+
+TEST(FixedCircularDeque, SequenceNumbersAfterRemovingFromTheBack)
+{
+    FixedCircularDeque<int, 4> var1{10, 11, 12};
+    var1.pop_back();
+    EXPECT_EQ(0, var1.front_sequence());
+    EXPECT_EQ(3, var1.next_sequence());
+    EXPECT_FALSE(var1.contains_sequence(2));
+
+    // A popped sequence number is not handed out again
+    var1.push_back(99);
+    EXPECT_EQ(4, var1.next_sequence());
+    EXPECT_FALSE(var1.at_sequence(2).has_value());
+    EXPECT_EQ(99, var1.at_sequence(3).value());
+    EXPECT_EQ(11, var1.at_sequence(1).value());
+
+    // Overwriting the front skips the gap
+    var1.push_back(100);
+    var1.push_back(101);
+    EXPECT_EQ(1, var1.front_sequence());
+    var1.pop_front();
+    EXPECT_EQ(3, var1.front_sequence());
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{99, 100, 101}));
+
+    var1.resize(1);
+    EXPECT_EQ(6, var1.next_sequence());
+    EXPECT_FALSE(var1.contains_sequence(5));
+    var1.resize(2);
+    EXPECT_EQ(7, var1.next_sequence());
+    EXPECT_EQ(0, var1.at_sequence(6).value());
+}
+
+TEST(FixedCircularDeque, SequenceNumbersAfterModifyingTheMiddle)
+{
+    FixedCircularDeque<int, 8> var1{10, 11, 12, 13, 14};
+    var1.erase(std::next(var1.cbegin(), 2));
+    EXPECT_FALSE(var1.contains_sequence(2));
+    EXPECT_EQ(11, var1.at_sequence(1).value());
+    EXPECT_EQ(13, var1.at_sequence(3).value());
+    EXPECT_EQ(5, var1.next_sequence());
+
+    // The elements after the position get new sequence numbers
+    var1.insert(std::next(var1.cbegin(), 1), 20);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{10, 20, 11, 13, 14}));
+    EXPECT_EQ(10, var1.at_sequence(0).value());
+    EXPECT_FALSE(var1.contains_sequence(1));
+    EXPECT_EQ(9, var1.next_sequence());
+    EXPECT_EQ(20, var1.at_sequence(5).value());
+    EXPECT_EQ(14, var1.at_sequence(8).value());
+
+    var1.push_front(30);
+    EXPECT_EQ(15, var1.next_sequence());
+    EXPECT_EQ(9, var1.front_sequence());
+    EXPECT_EQ(30, var1.at_sequence(9).value());
+}
+
+TEST(FixedCircularDeque, SequenceNumbersRandomOperations)
+{
+    // Every value is pushed once, so a sequence number must never be seen with two values
+    std::mt19937 generator{42};
+    FixedCircularDeque<int, 6> var1{};
+    std::map<FixedCircularDeque<int, 6>::sequence_type, int> seen{};
+    int next_value = 0;
+    for (int step = 0; step < 3000; step++)
+    {
+        const auto previous_next_sequence = var1.next_sequence();
+        const std::size_t position = var1.empty() ? 0 : generator() % var1.size();
+        switch (generator() % 8)
+        {
+        case 0:
+        case 1:
+        case 2:
+            var1.push_back(next_value++);
+            break;
+        case 3:
+            var1.push_front(next_value++);
+            break;
+        case 4:
+            if (!var1.empty())
+            {
+                var1.pop_back();
+            }
+            break;
+        case 5:
+            if (!var1.empty())
+            {
+                var1.pop_front();
+            }
+            break;
+        case 6:
+            if (!var1.empty())
+            {
+                const auto pos = std::next(var1.cbegin(), static_cast<std::ptrdiff_t>(position));
+                var1.erase(pos, std::next(pos, generator() % 2 == 0 ? 0 : 1));
+            }
+            break;
+        default:
+            if (var1.size() < var1.max_size())
+            {
+                var1.insert(std::next(var1.cbegin(), static_cast<std::ptrdiff_t>(position)),
+                            next_value++);
+            }
+            break;
+        }
+
+        ASSERT_LE(previous_next_sequence, var1.next_sequence());
+        std::size_t held_count = 0;
+        for (auto sequence = var1.front_sequence(); sequence < var1.next_sequence(); sequence++)
+        {
+            if (!var1.contains_sequence(sequence))
+            {
+                continue;
+            }
+            held_count++;
+            const int value = var1.at_sequence(sequence).value();
+            const auto [it, inserted] = seen.try_emplace(sequence, value);
+            ASSERT_EQ(it->second, value);
+        }
+        ASSERT_EQ(var1.size(), held_count);
+        ASSERT_FALSE(var1.contains_sequence(var1.front_sequence() - 1));
+    }
+}
+
+TEST(FixedCircularDeque, SequenceNumbersWithReaders)
+{
+    // A writer keeps the recent history and each reader polls at its own pace, counting the
+    // elements that were overwritten before it got to them
+    struct Reader
+    {
+        FixedCircularDeque<int, 4>::sequence_type cursor = 0;
+        std::deque<int> seen{};
+        std::size_t missed_count = 0;
+
+        void poll(const FixedCircularDeque<int, 4>& history)
+        {
+            if (cursor < history.front_sequence())
+            {
+                missed_count += static_cast<std::size_t>(history.front_sequence() - cursor);
+                cursor = history.front_sequence();
+            }
+            for (; cursor < history.next_sequence(); cursor++)
+            {
+                seen.push_back(history.at_sequence(cursor).value());
+            }
+        }
+    };
+
+    FixedCircularDeque<int, 4> history{};
+    Reader fast{};
+    Reader slow{};
+    for (int i = 0; i < 20; i++)
+    {
+        history.push_back(i);
+        fast.poll(history);
+        if (i % 6 == 5)
+        {
+            slow.poll(history);
+        }
+    }
+    slow.poll(history);
+
+    EXPECT_EQ(0, fast.missed_count);
+    EXPECT_EQ(20, fast.seen.size());
+    EXPECT_EQ(20, slow.missed_count + slow.seen.size());
+    EXPECT_EQ((std::deque<int>{2, 3, 4, 5, 8, 9, 10, 11, 14, 15, 16, 17, 18, 19}), slow.seen);
+}
+
 TEST(FixedCircularDeque, OverloadedAddressOfOperator)
 {
     {
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <span>
 
 namespace fixed_containers
 {
@@ -201,6 +202,45 @@ TEST(FixedCircularQueue, Pop)
     static_assert(VAL1.size() == 1);
 }
 
+TEST(FixedCircularQueue, PushNAndPopN)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedCircularQueue<int, 4> var{};
+        var.push_n(std::array{0, 1, 2});
+        var.push_n(std::array{3, 4});  // Overwrites 0
+        return var;
+    }();
+    static_assert(is_full(VAL1));
+    static_assert(VAL1.front() == 1);
+    static_assert(VAL1.back() == 4);
+
+    FixedCircularQueue<int, 4> var1{};
+    var1.push_n(std::array{0, 1, 2, 3, 4, 5});  // Only the last 4 are kept
+    EXPECT_EQ(2, var1.front());
+    var1.push_n(std::array{6, 7});
+
+    std::array<int, 3> out1{};
+    EXPECT_EQ(3, var1.pop_n(out1));
+    EXPECT_EQ((std::array{4, 5, 6}), out1);
+    EXPECT_EQ(1, var1.size());
+    EXPECT_EQ(7, var1.front());
+
+    int sum = 0;
+    var1.push_n(std::array{8, 9, 10, 11});
+    EXPECT_EQ(4,
+              var1.consume(4,
+                           [&sum](const std::span<int> segment)
+                           {
+                               for (const int entry : segment)
+                               {
+                                   sum += entry;
+                               }
+                           }));
+    EXPECT_EQ(38, sum);
+    EXPECT_TRUE(var1.empty());
+}
+
 TEST(FixedCircularQueue, Equality)
 {
     static constexpr std::array<int, 2> ENTRY_A1{1, 2};
@@ -6,6 +6,7 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -14,10 +15,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -39,6 +43,12 @@ static_assert(std::random_access_iterator<DequeType::const_iterator>);
 
 }  // namespace trivially_copyable_deque
 
+// The size is stored in the narrowest integer that can hold the capacity, next to the array. The
+// starting index is always a std::size_t.
+static_assert(consteval_compare::equal<24, sizeof(FixedDeque<std::uint8_t, 15>)>);
+static_assert(consteval_compare::equal<32, sizeof(FixedDeque<int, 5>)>);
+static_assert(consteval_compare::equal<1216, sizeof(FixedDeque<int, 300>)>);
+
 struct ComplexStruct
 {
     constexpr ComplexStruct(int param_a, int param_b1, int param_b2, int param_c)
@@ -60,10 +70,10 @@ template <typename T, std::size_t MAXIMUM_SIZE>
 constexpr FixedDeque<T, MAXIMUM_SIZE>& set_deque_initial_state(FixedDeque<T, MAXIMUM_SIZE>& deque,
                                                                std::size_t initial_starting_index)
 {
-    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.start ==
+    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ ==
                     STARTING_OFFSET_OF_TEST);
-    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.distance == 0);
-    deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_and_size_.start = initial_starting_index;
+    assert_or_abort(deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ == 0);
+    deque.IMPLEMENTATION_DETAIL_DO_NOT_USE_starting_index_ = initial_starting_index;
     return deque;
 }
 
@@ -1772,6 +1782,37 @@ TEST(FixedDeque, EraseRange)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, EraseEmptyRange)
+{
+    auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
+    {
+        constexpr auto VAL1 = []()
+        {
+            auto var = Factory::template create<int, 8>({0, 1, 2, 3});
+            var.erase(std::next(var.cbegin(), 1), std::next(var.cbegin(), 1));
+            return var;
+        }();
+
+        static_assert(std::ranges::equal(VAL1, std::array<int, 4>{0, 1, 2, 3}));
+
+        {
+            auto var =
+                Factory::template create<std::deque<int>, 8>({{1, 2, 3}, {4, 5}, {}, {6, 7, 8}});
+            auto iter = var.erase(std::next(var.begin(), 1), std::next(var.begin(), 1));
+            EXPECT_EQ(iter, std::next(var.begin(), 1));
+            iter = var.erase(std::next(var.begin(), 3), std::next(var.begin(), 3));
+            EXPECT_EQ(iter, std::next(var.begin(), 3));
+            iter = var.erase(var.end(), var.end());
+            EXPECT_EQ(iter, var.end());
+            EXPECT_TRUE(std::ranges::equal(
+                var, std::deque<std::deque<int>>{{1, 2, 3}, {4, 5}, {}, {6, 7, 8}}));
+        }
+    };
+
+    run_test(FixedDequeInitialStateFirstIndex{});
+    run_test(FixedDequeInitialStateLastIndex{});
+}
+
 TEST(FixedDeque, EraseOne)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
@@ -1829,6 +1870,170 @@ TEST(FixedDeque, EraseOne)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, InsertAndEraseWithWraparound)
+{
+    // Exercise every starting position, so that the shifted ranges wrap around the storage
+    for (int start = 0; start < 7; start++)
+    {
+        FixedDeque<int, 7> var{};
+        std::deque<int> expected{};
+        for (int i = 0; i < start; i++)
+        {
+            var.push_back(-1);
+            var.pop_front();
+        }
+        for (int i = 0; i < 4; i++)
+        {
+            var.push_back(i);
+            expected.push_back(i);
+        }
+
+        var.insert(std::next(var.cbegin(), 1), {10, 11, 12});
+        expected.insert(std::next(expected.cbegin(), 1), {10, 11, 12});
+        EXPECT_TRUE(std::ranges::equal(var, expected));
+
+        var.erase(std::next(var.cbegin(), 2), std::next(var.cbegin(), 5));
+        expected.erase(std::next(expected.cbegin(), 2), std::next(expected.cbegin(), 5));
+        EXPECT_TRUE(std::ranges::equal(var, expected));
+    }
+}
+
+TEST(FixedDeque, InsertAndEraseTriviallyRelocatable)
+{
+    MockTriviallyRelocatableInt::move_construction_counter = 0;
+    FixedDeque<MockTriviallyRelocatableInt, 8> var{};
+    for (int i = 0; i < 4; i++)
+    {
+        var.emplace_back(i);
+    }
+    var.emplace_front(-1);
+
+    var.insert(std::next(var.cbegin(), 2), {10, 11});
+    EXPECT_TRUE(std::ranges::equal(
+        var, std::array<MockTriviallyRelocatableInt, 7>{-1, 0, 10, 11, 1, 2, 3}));
+    var.erase(std::next(var.cbegin(), 1), std::next(var.cbegin(), 3));
+    EXPECT_TRUE(
+        std::ranges::equal(var, std::array<MockTriviallyRelocatableInt, 5>{-1, 11, 1, 2, 3}));
+
+    // Shifting is done with memmove instead of move-construction
+    EXPECT_EQ(0, MockTriviallyRelocatableInt::move_construction_counter);
+}
+
+namespace
+{
+// Neither trivially copyable nor trivially relocatable, so every shifted element is counted
+struct MoveCountingInt
+{
+    static inline std::size_t move_construction_counter = 0;
+
+    int value = 0;
+
+    explicit(false) MoveCountingInt(int val)
+      : value{val}
+    {
+    }
+    MoveCountingInt(const MoveCountingInt& other) = default;
+    MoveCountingInt(MoveCountingInt&& other) noexcept
+      : value{other.value}
+    {
+        move_construction_counter++;
+    }
+    MoveCountingInt& operator=(const MoveCountingInt& other) = default;
+    MoveCountingInt& operator=(MoveCountingInt&& other) noexcept = default;
+    ~MoveCountingInt() {}  // NOLINT(modernize-use-equals-default)
+
+    bool operator==(const MoveCountingInt& other) const = default;
+};
+}  // namespace
+
+TEST(FixedDeque, InsertAndEraseMoveTheShorterSide)
+{
+    FixedDeque<MoveCountingInt, 16> var{};
+    for (int i = 0; i < 10; i++)
+    {
+        var.emplace_back(i);
+    }
+
+    MoveCountingInt::move_construction_counter = 0;
+    var.emplace(std::next(var.cbegin(), 1), 100);
+    EXPECT_EQ(1, MoveCountingInt::move_construction_counter);
+    var.emplace(std::next(var.cbegin(), 10), 200);
+    EXPECT_EQ(2, MoveCountingInt::move_construction_counter);
+    EXPECT_TRUE(std::ranges::equal(
+        var, std::array<MoveCountingInt, 12>{0, 100, 1, 2, 3, 4, 5, 6, 7, 8, 200, 9}));
+
+    MoveCountingInt::move_construction_counter = 0;
+    auto it = var.erase(std::next(var.cbegin(), 1), std::next(var.cbegin(), 3));
+    EXPECT_EQ(1, MoveCountingInt::move_construction_counter);
+    EXPECT_EQ(2, it->value);
+    it = var.erase(std::next(var.cbegin(), 8));
+    EXPECT_EQ(2, MoveCountingInt::move_construction_counter);
+    EXPECT_EQ(9, it->value);
+    EXPECT_TRUE(
+        std::ranges::equal(var, std::array<MoveCountingInt, 9>{0, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(FixedDeque, InsertAndEraseAtEveryPosition)
+{
+    // Both sides of the gap, at every starting position so that the shifted ranges wrap around
+    const auto run_test = []<typename T>(const T& /*unused*/)
+    {
+        for (int start = 0; start < 9; start++)
+        {
+            for (std::size_t offset = 0; offset <= 6; offset++)
+            {
+                FixedDeque<T, 9> var{};
+                std::deque<int> expected{};
+                for (int i = 0; i < start; i++)
+                {
+                    var.push_back(-1);
+                    var.pop_front();
+                }
+                for (int i = 0; i < 6; i++)
+                {
+                    var.push_back(i);
+                    expected.push_back(i);
+                }
+                const auto equal = [&]()
+                {
+                    return std::ranges::equal(
+                        var, expected, [](const T& lhs, int rhs) { return lhs == T{rhs}; });
+                };
+
+                const auto at = static_cast<std::ptrdiff_t>(offset);
+                auto it = var.insert(std::next(var.cbegin(), at), {10, 11, 12});
+                expected.insert(std::next(expected.cbegin(), at), {10, 11, 12});
+                EXPECT_TRUE(*it == T{10});
+                EXPECT_TRUE(equal());
+
+                it = var.erase(std::next(var.cbegin(), at), std::next(var.cbegin(), at + 2));
+                expected.erase(std::next(expected.cbegin(), at),
+                               std::next(expected.cbegin(), at + 2));
+                EXPECT_TRUE(*it == T{12});
+                EXPECT_TRUE(equal());
+
+                it = var.erase(std::next(var.cbegin(), at));
+                expected.erase(std::next(expected.cbegin(), at));
+                EXPECT_EQ(std::distance(var.begin(), it), at);
+                EXPECT_TRUE(equal());
+            }
+        }
+    };
+    run_test(int{});
+    run_test(MockTriviallyRelocatableInt{0});
+    run_test(MoveCountingInt{0});
+
+    constexpr auto VAL1 = []()
+    {
+        FixedDeque<int, 8> var{1, 2, 3, 4, 5, 6};
+        var.insert(std::next(var.cbegin(), 1), {10, 11});
+        var.erase(std::next(var.cbegin(), 2), std::next(var.cbegin(), 4));
+        var.erase(std::next(var.cbegin(), 5));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array<int, 5>{1, 10, 3, 4, 5}));
+}
+
 TEST(FixedDeque, EraseEmpty)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
@@ -1911,6 +2116,21 @@ TEST(FixedDeque, EraseIf)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, EraseUnorderedIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedDeque<int, 8> var{0, 1, 2, 3, 4, 5, 6};
+        const std::size_t removed_count = fixed_containers::erase_unordered_if(
+            var, [](const int& entry) { return (entry % 2) == 0; });
+        assert_or_abort(4 == removed_count);
+        return var;
+    }();
+
+    // Holes are filled from the back
+    static_assert(std::ranges::equal(VAL1, std::array<int, 3>{5, 1, 3}));
+}
+
 TEST(FixedDeque, Front)
 {
     auto run_test = []<IsFixedDequeFactory Factory>(Factory&&)
@@ -1999,6 +2219,170 @@ TEST(FixedDeque, BackEmptyContainer)
     run_test(FixedDequeInitialStateLastIndex{});
 }
 
+TEST(FixedDeque, FindCountContains)
+{
+    constexpr auto VAL1 = []()
+    {
+        auto var = FixedDequeInitialStateLastIndex::create<int, 8>({3, 1});
+        var.push_front(2);
+        var.push_back(3);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{2, 3, 1, 3}));
+    static_assert(VAL1.find(3) == std::next(VAL1.cbegin()));
+    static_assert(VAL1.find(7) == VAL1.cend());
+    static_assert(VAL1.count(3) == 2);
+    static_assert(VAL1.contains(1));
+    static_assert(!VAL1.contains(7));
+
+    // Wrap around the end of the storage, with each segment spanning several blocks
+    FixedDeque<std::uint8_t, 200> var1{};
+    for (std::size_t i = 0; i < 150; i++)
+    {
+        var1.push_back(1);
+    }
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        var1.pop_front();
+    }
+    for (std::size_t i = 0; i < 120; i++)
+    {
+        var1.push_back(1);
+    }
+    EXPECT_EQ(170, var1.size());
+    EXPECT_EQ(var1.end(), var1.find(7));
+    EXPECT_EQ(0, var1.count(7));
+    EXPECT_EQ(170, var1.count(1));
+
+    var1[130] = 7;
+    var1[169] = 7;
+    EXPECT_EQ(std::next(var1.begin(), 130), var1.find(7));
+    EXPECT_EQ(2, var1.count(7));
+    var1[20] = 7;
+    EXPECT_EQ(std::next(var1.begin(), 20), var1.find(7));
+    EXPECT_EQ(3, var1.count(7));
+    EXPECT_TRUE(std::as_const(var1).contains(7));
+    *var1.find(7) = 8;
+    EXPECT_EQ(std::next(var1.cbegin(), 130), std::as_const(var1).find(7));
+
+    const FixedDeque<int, 8> var2{};
+    EXPECT_EQ(var2.end(), var2.find(0));
+    EXPECT_EQ(0, var2.count(0));
+}
+
+TEST(FixedDeque, AsSpans)
+{
+    constexpr FixedDeque<int, 8> VAL1{};
+    static_assert(VAL1.as_spans()[0].empty());
+    static_assert(VAL1.as_spans()[1].empty());
+
+    FixedDeque<int, 8> var1{1, 2, 3};
+    auto spans1 = var1.as_spans();
+    EXPECT_TRUE(std::ranges::equal(spans1[0], std::array{1, 2, 3}));
+    EXPECT_TRUE(spans1[1].empty());
+
+    // Wrap around the end of the storage
+    var1.push_front(0);
+    var1.push_front(-1);
+    spans1 = var1.as_spans();
+    EXPECT_TRUE(std::ranges::equal(spans1[0], std::array{-1, 0}));
+    EXPECT_TRUE(std::ranges::equal(spans1[1], std::array{1, 2, 3}));
+
+    // Writes through the spans are visible through the deque
+    spans1[0][1] = 10;
+    spans1[1][2] = 30;
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{-1, 10, 1, 2, 30}));
+
+    const auto spans2 = std::as_const(var1).as_spans();
+    EXPECT_EQ(var1.size(), spans2[0].size() + spans2[1].size());
+}
+
+TEST(FixedDeque, Linearize)
+{
+    FixedDeque<int, 8> var1{};
+    EXPECT_TRUE(var1.linearize().empty());
+
+    // Contiguous, but not at the beginning of the storage
+    var1 = {0, 1, 2, 3, 4};
+    var1.pop_front();
+    var1.pop_front();
+    const std::span<int> span1 = var1.linearize();
+    EXPECT_TRUE(std::ranges::equal(span1, std::array{2, 3, 4}));
+    EXPECT_EQ(std::addressof(var1.front()), span1.data());
+
+    // Wrapped
+    var1.push_front(1);
+    var1.push_front(0);
+    var1.push_front(-1);
+    EXPECT_FALSE(var1.as_spans()[1].empty());
+    const std::span<int> span2 = var1.linearize();
+    EXPECT_TRUE(std::ranges::equal(span2, std::array{-1, 0, 1, 2, 3, 4}));
+    EXPECT_TRUE(var1.as_spans()[1].empty());
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{-1, 0, 1, 2, 3, 4}));
+
+    // Full and wrapped
+    var1.push_front(-2);
+    var1.push_front(-3);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_TRUE(std::ranges::equal(var1.linearize(), std::array{-3, -2, -1, 0, 1, 2, 3, 4}));
+
+    // Still a regular deque afterwards
+    var1.pop_back();
+    var1.push_front(-4);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{-4, -3, -2, -1, 0, 1, 2, 3}));
+    EXPECT_EQ(std::next(var1.begin(), 4), var1.find(0));
+    EXPECT_EQ(1, var1.count(-4));
+}
+
+TEST(FixedDeque, LinearizeNonTrivial)
+{
+    FixedDeque<MockNonTrivialInt, 8> var1{};
+    for (int i = 0; i < 4; i++)
+    {
+        var1.push_back(i);
+        var1.push_front(-i - 1);
+    }
+    // {-4, -3, -2, -1, 0, 1, 2, 3}
+    EXPECT_FALSE(var1.as_spans()[1].empty());
+    const std::span<MockNonTrivialInt> span1 = var1.linearize();
+    EXPECT_EQ(8, span1.size());
+    for (std::size_t i = 0; i < span1.size(); i++)
+    {
+        EXPECT_EQ(static_cast<int>(i) - 4, span1[i].value);
+    }
+}
+
+TEST(FixedDeque, PushBackNAndPopFrontN)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedDeque<int, 8> var{0, 1, 2};
+        var.push_back_n(std::array{3, 4});
+        var.pop_front_n(2);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{2, 3, 4}));
+
+    // Wraps around the end of the storage
+    FixedDeque<int, 8> var1{0, 1, 2, 3, 4, 5};
+    var1.pop_front_n(4);
+    var1.push_back_n(std::array{6, 7, 8, 9, 10});
+    EXPECT_FALSE(var1.as_spans()[1].empty());
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{4, 5, 6, 7, 8, 9, 10}));
+    var1.push_back_n(std::span<const int>{});
+    EXPECT_EQ(7, var1.size());
+    EXPECT_DEATH(var1.push_back_n(std::array{11, 12}), "");
+    EXPECT_DEATH(var1.pop_front_n(8), "");
+
+    FixedDeque<MockNonTrivialInt, 4> var2{};
+    var2.push_back_n(std::array<MockNonTrivialInt, 3>{1, 2, 3});
+    var2.pop_front_n(2);
+    var2.push_back_n(std::array<MockNonTrivialInt, 3>{4, 5, 6});
+    EXPECT_EQ(4, var2.size());
+    EXPECT_EQ(3, var2.front().value);
+    EXPECT_EQ(6, var2.back().value);
+}
+
 TEST(FixedDeque, MoveableButNotCopyable)
 {
     // Compile-only test
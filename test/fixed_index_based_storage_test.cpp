@@ -0,0 +1,408 @@
+#include "fixed_containers/fixed_index_based_storage.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fixed_containers
+{
+namespace
+{
+static_assert(IsFixedIndexBasedBulkStorage<FixedIndexBasedGenerationalPoolStorage<int, 5>>);
+static_assert(IsStructuralType<FixedIndexBasedGenerationalPoolStorage<int, 5>>);
+static_assert(TriviallyCopyable<FixedIndexBasedGenerationalPoolStorage<int, 5>>);
+static_assert(sizeof(GenerationalIndex) == sizeof(std::uint64_t));
+
+// Raw views rely on this layout
+static_assert(sizeof(FixedIndexBasedPoolStorage<int, 130>) ==
+              (130 * sizeof(std::size_t)) + sizeof(std::size_t) +
+                  fixed_index_based_storage_detail::slot_bitset_size_bytes(130));
+static_assert(sizeof(fixed_index_based_storage_detail::SlotBitset<130>) ==
+              fixed_index_based_storage_detail::slot_bitset_size_bytes(130));
+
+static_assert(IsFixedIndexBasedBulkStorage<FixedIndexBasedAddressOrderedPoolStorage<int, 5>>);
+static_assert(IsStructuralType<FixedIndexBasedAddressOrderedPoolStorage<int, 5>>);
+static_assert(sizeof(FixedIndexBasedAddressOrderedPoolStorage<int, 5>) ==
+              sizeof(FixedIndexBasedPoolStorage<int, 5>));
+static_assert(IsFixedIndexBasedBulkStorage<FixedIndexBasedLowestIndexPoolStorage<int, 5>>);
+static_assert(IsStructuralType<FixedIndexBasedLowestIndexPoolStorage<int, 5>>);
+static_assert(TriviallyCopyable<FixedIndexBasedLowestIndexPoolStorage<int, 5>>);
+static_assert(IsFixedIndexBasedBulkStorage<FixedIndexBasedPoolStorage<int, 5>>);
+
+// Custom storages only need the per-entry operations; the bulk ones are a separate refinement
+struct PerEntryOnlyStorage
+{
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    [[nodiscard]] int& at(std::size_t index);
+    [[nodiscard]] const int& at(std::size_t index) const;
+    [[nodiscard]] bool full() const;
+    std::size_t emplace_and_return_index();
+    std::size_t delete_at_and_return_repositioned_index(std::size_t index);
+};
+static_assert(IsFixedIndexBasedStorage<PerEntryOnlyStorage>);
+static_assert(!IsFixedIndexBasedBulkStorage<PerEntryOnlyStorage>);
+
+// Emplaces MAXIMUM_SIZE values, deletes the ones at `deletion_order` and returns the indexes of
+// the next `deletion_order.size()` emplacements.
+template <template <typename, std::size_t> typename StorageTemplate,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t DELETION_COUNT>
+constexpr std::array<std::size_t, DELETION_COUNT> reallocation_order(
+    const std::array<std::size_t, DELETION_COUNT>& deletion_order)
+{
+    StorageTemplate<int, MAXIMUM_SIZE> storage{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        storage.emplace_and_return_index(static_cast<int>(i));
+    }
+    for (const std::size_t index : deletion_order)
+    {
+        storage.delete_at_and_return_repositioned_index(index);
+    }
+    std::array<std::size_t, DELETION_COUNT> out{};
+    for (std::size_t& index : out)
+    {
+        index = storage.emplace_and_return_index(0);
+    }
+    return out;
+}
+
+// Emplaces MAXIMUM_SIZE values, deletes the even ones and compacts the odd ones in reverse
+// order. Returns the values in index order followed by the index handed out next.
+template <template <typename, std::size_t> typename StorageTemplate, std::size_t MAXIMUM_SIZE>
+constexpr std::array<int, (MAXIMUM_SIZE / 2) + 1> compact_odd_values_in_reverse()
+{
+    StorageTemplate<int, MAXIMUM_SIZE> storage{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        storage.emplace_and_return_index(static_cast<int>(i));
+    }
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i += 2)
+    {
+        storage.delete_at_and_return_repositioned_index(i);
+    }
+    constexpr std::size_t REMAINING = MAXIMUM_SIZE / 2;
+    storage.compact([&](const std::size_t index)
+                    { return REMAINING - 1 - (static_cast<std::size_t>(storage.at(index)) / 2); },
+                    [](const std::size_t, const std::size_t) {});
+
+    std::array<int, REMAINING + 1> out{};
+    for (std::size_t i = 0; i < REMAINING; i++)
+    {
+        out[i] = storage.at(i);
+    }
+    out[REMAINING] = static_cast<int>(storage.emplace_and_return_index(0));
+    return out;
+}
+}  // namespace
+
+TEST(FixedIndexBasedGenerationalPoolStorage, EmplaceAndAccess)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+        const GenerationalIndex handle = storage.emplace_and_return_handle(7);
+        storage.at(handle) += 1;
+        return storage.at(handle);
+    }();
+    static_assert(VAL1 == 8);
+
+    FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+    const GenerationalIndex h0 = storage.emplace_and_return_handle(10);
+    const GenerationalIndex h1 = storage.emplace_and_return_handle(20);
+    EXPECT_NE(h0, h1);
+    EXPECT_TRUE(storage.contains(h0));
+    EXPECT_TRUE(storage.contains(h1));
+    EXPECT_EQ(10, storage.at(h0));
+    EXPECT_EQ(20, storage.at(h1));
+    EXPECT_EQ(10, storage.at(std::size_t{h0.index}));
+    EXPECT_EQ(h1, storage.handle_of(h1.index));
+    EXPECT_FALSE(storage.full());
+
+    storage.emplace_and_return_handle(30);
+    EXPECT_TRUE(storage.full());
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, DefaultHandleIsNeverValid)
+{
+    FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+    EXPECT_FALSE(storage.contains(GenerationalIndex{}));
+    storage.emplace_and_return_handle(10);
+    EXPECT_FALSE(storage.contains(GenerationalIndex{}));
+    EXPECT_FALSE(storage.try_at(GenerationalIndex{}).has_value());
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, OutOfRangeHandle)
+{
+    FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+    const GenerationalIndex handle = storage.emplace_and_return_handle(10);
+    EXPECT_FALSE(storage.contains(GenerationalIndex{.index = 3, .generation = handle.generation}));
+    EXPECT_FALSE(storage.contains_at(3));
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, StaleHandleAfterReuse)
+{
+    FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+    const GenerationalIndex old_handle = storage.emplace_and_return_handle(10);
+    EXPECT_TRUE(storage.delete_at(old_handle));
+    EXPECT_FALSE(storage.contains(old_handle));
+    EXPECT_FALSE(storage.contains_at(old_handle.index));
+
+    // The freed slot is reused, but the generation differs
+    const GenerationalIndex new_handle = storage.emplace_and_return_handle(20);
+    EXPECT_EQ(old_handle.index, new_handle.index);
+    EXPECT_NE(old_handle.generation, new_handle.generation);
+    EXPECT_FALSE(storage.contains(old_handle));
+    EXPECT_TRUE(storage.contains(new_handle));
+    EXPECT_FALSE(storage.try_at(old_handle).has_value());
+    EXPECT_EQ(20, storage.try_at(new_handle).value());
+
+    // Deleting through a stale handle is a no-op
+    EXPECT_FALSE(storage.delete_at(old_handle));
+    EXPECT_TRUE(storage.contains(new_handle));
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, TryAt)
+{
+    FixedIndexBasedGenerationalPoolStorage<int, 3> storage{};
+    const GenerationalIndex handle = storage.emplace_and_return_handle(10);
+
+    auto entry = storage.try_at(handle);
+    ASSERT_TRUE(entry.has_value());
+    *entry = 11;
+    EXPECT_EQ(11, storage.at(handle));
+
+    const auto& const_storage = storage;
+    auto const_entry = const_storage.try_at(handle);
+    static_assert(std::is_same_v<decltype(const_entry), OptionalReference<const int>>);
+    ASSERT_TRUE(const_entry.has_value());
+    EXPECT_EQ(11, const_entry.value());
+
+    storage.delete_at_and_return_repositioned_index(handle.index);
+    EXPECT_FALSE(storage.try_at(handle).has_value());
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, NonTriviallyCopyable)
+{
+    FixedIndexBasedGenerationalPoolStorage<MockNonTrivialInt, 3> storage{};
+    const GenerationalIndex handle = storage.emplace_and_return_handle(5);
+    EXPECT_EQ(5, storage.at(handle).value);
+    EXPECT_TRUE(storage.delete_at(handle));
+    EXPECT_FALSE(storage.contains(handle));
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, ClearAndCopyLiveFrom)
+{
+    FixedIndexBasedGenerationalPoolStorage<MockNonTrivialInt, 4> storage{};
+    const GenerationalIndex h0 = storage.emplace_and_return_handle(0);
+    const GenerationalIndex h1 = storage.emplace_and_return_handle(1);
+    storage.clear();
+    EXPECT_FALSE(storage.contains(h0));
+    EXPECT_FALSE(storage.contains(h1));
+
+    // Handles of the source stay valid for a fresh copy
+    FixedIndexBasedGenerationalPoolStorage<MockNonTrivialInt, 4> other{};
+    const GenerationalIndex h2 = other.emplace_and_return_handle(2);
+    FixedIndexBasedGenerationalPoolStorage<MockNonTrivialInt, 4> copy{};
+    copy.copy_live_from(other);
+    EXPECT_EQ(2, copy.at(h2).value);
+
+    // But never bring back a stale handle of the destination
+    storage.copy_live_from(other);
+    EXPECT_FALSE(storage.contains(h0));
+    EXPECT_EQ(2, storage.at(storage.handle_of(h2.index)).value);
+    storage.clear();
+    other.clear();
+    copy.clear();
+}
+
+TEST(FixedIndexBasedGenerationalPoolStorage, Compact)
+{
+    FixedIndexBasedGenerationalPoolStorage<int, 4> storage{};
+    std::array<GenerationalIndex, 4> handles{};
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        handles.at(i) = storage.emplace_and_return_handle(static_cast<int>(i));
+    }
+    storage.delete_at(handles[0]);
+    storage.delete_at(handles[2]);
+
+    // Move 3 -> 0, keep 1
+    storage.compact([](const std::size_t index) { return index == 3 ? 0 : index; },
+                    [](const std::size_t, const std::size_t) {});
+    EXPECT_TRUE(storage.contains(handles[1]));
+    EXPECT_FALSE(storage.contains(handles[3]));
+    EXPECT_FALSE(storage.contains(handles[0]));
+    EXPECT_TRUE(storage.contains_at(0));
+    EXPECT_FALSE(storage.contains_at(3));
+    EXPECT_EQ(3, storage.at(storage.handle_of(0)));
+}
+
+TEST(FixedIndexBasedPoolStorage, AllocationPolicies)
+{
+    static constexpr std::array<std::size_t, 3> DELETION_ORDER{5, 1, 3};
+
+    // The most recently freed slot is reused first
+    static_assert(reallocation_order<FixedIndexBasedPoolStorage, 8>(DELETION_ORDER) ==
+                  std::array<std::size_t, 3>{3, 1, 5});
+    // The lowest free slot is reused first
+    static_assert(
+        reallocation_order<FixedIndexBasedAddressOrderedPoolStorage, 8>(DELETION_ORDER) ==
+        std::array<std::size_t, 3>{1, 3, 5});
+    static_assert(reallocation_order<FixedIndexBasedLowestIndexPoolStorage, 8>(DELETION_ORDER) ==
+                  std::array<std::size_t, 3>{1, 3, 5});
+    // Spans more than one bitmap word
+    static_assert(reallocation_order<FixedIndexBasedLowestIndexPoolStorage, 130>(
+                      std::array<std::size_t, 3>{129, 64, 70}) ==
+                  std::array<std::size_t, 3>{64, 70, 129});
+
+    EXPECT_EQ((std::array<std::size_t, 3>{1, 3, 5}),
+              (reallocation_order<FixedIndexBasedLowestIndexPoolStorage, 8>(DELETION_ORDER)));
+}
+
+TEST(FixedIndexBasedPoolStorage, Compact)
+{
+    static constexpr std::array<int, 5> EXPECTED{7, 5, 3, 1, 4};
+    static_assert(compact_odd_values_in_reverse<FixedIndexBasedPoolStorage, 8>() == EXPECTED);
+    static_assert(compact_odd_values_in_reverse<FixedIndexBasedAddressOrderedPoolStorage, 8>() ==
+                  EXPECTED);
+    static_assert(compact_odd_values_in_reverse<FixedIndexBasedLowestIndexPoolStorage, 8>() ==
+                  EXPECTED);
+
+    EXPECT_EQ(EXPECTED, (compact_odd_values_in_reverse<FixedIndexBasedPoolStorage, 8>()));
+}
+
+TEST(FixedIndexBasedPoolStorage, CompactNonTriviallyCopyable)
+{
+    FixedIndexBasedPoolStorage<MockNonTrivialInt, 4> storage{};
+    const std::size_t i0 = storage.emplace_and_return_index(10);
+    const std::size_t i1 = storage.emplace_and_return_index(11);
+    const std::size_t i2 = storage.emplace_and_return_index(12);
+    storage.delete_at_and_return_repositioned_index(i0);
+
+    std::array<std::size_t, 4> side_table{0, 1, 2, 3};
+    storage.compact([&](const std::size_t index)
+                    { return static_cast<std::size_t>(storage.at(index).value - 11); },
+                    [&](const std::size_t first, const std::size_t second)
+                    { std::swap(side_table[first], side_table[second]); });
+
+    EXPECT_EQ(11, storage.at(0).value);
+    EXPECT_EQ(12, storage.at(1).value);
+    EXPECT_EQ(i1, side_table[0]);
+    EXPECT_EQ(i2, side_table[1]);
+    EXPECT_EQ(2, storage.emplace_and_return_index(13));
+    EXPECT_EQ(3, storage.emplace_and_return_index(14));
+    EXPECT_TRUE(storage.full());
+}
+
+TEST(FixedIndexBasedPoolStorage, ForEachLive)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexBasedPoolStorage<int, 130> storage{};
+        for (std::size_t i = 0; i < 130; i++)
+        {
+            storage.emplace_and_return_index(static_cast<int>(i));
+        }
+        for (std::size_t i = 0; i < 130; i++)
+        {
+            if (i != 3 && i != 64 && i != 129)
+            {
+                storage.delete_at_and_return_repositioned_index(i);
+            }
+        }
+        std::array<int, 3> out{};
+        std::size_t count = 0;
+        storage.for_each_live([&](const std::size_t index)
+                              { out.at(count++) = storage.at(index); });
+        return out;
+    }();
+    static_assert(VAL1 == std::array<int, 3>{3, 64, 129});
+
+    FixedIndexBasedLowestIndexPoolStorage<int, 70> storage{};
+    for (std::size_t i = 0; i < 70; i++)
+    {
+        storage.emplace_and_return_index(static_cast<int>(i));
+    }
+    storage.delete_at_and_return_repositioned_index(0);
+    storage.delete_at_and_return_repositioned_index(65);
+    std::size_t count = 0;
+    storage.for_each_live(
+        [&](const std::size_t index)
+        {
+            EXPECT_TRUE(storage.is_occupied(index));
+            EXPECT_EQ(static_cast<int>(index), storage.at(index));
+            count++;
+        });
+    EXPECT_EQ(68, count);
+    EXPECT_FALSE(storage.is_occupied(0));
+    EXPECT_FALSE(storage.is_occupied(65));
+}
+
+TEST(FixedIndexBasedPoolStorage, Clear)
+{
+    FixedIndexBasedPoolStorage<MockNonTrivialInt, 8> lifo{};
+    FixedIndexBasedAddressOrderedPoolStorage<MockNonTrivialInt, 8> address_ordered{};
+    FixedIndexBasedLowestIndexPoolStorage<MockNonTrivialInt, 8> lowest_index{};
+    for (int i = 0; i < 8; i++)
+    {
+        lifo.emplace_and_return_index(i);
+        address_ordered.emplace_and_return_index(i);
+        lowest_index.emplace_and_return_index(i);
+    }
+    lifo.delete_at_and_return_repositioned_index(4);
+    address_ordered.delete_at_and_return_repositioned_index(4);
+    lowest_index.delete_at_and_return_repositioned_index(4);
+
+    lifo.clear();
+    address_ordered.clear();
+    lowest_index.clear();
+
+    std::size_t count = 0;
+    const auto count_live = [&count](const std::size_t /*index*/) { count++; };
+    lifo.for_each_live(count_live);
+    address_ordered.for_each_live(count_live);
+    lowest_index.for_each_live(count_live);
+    EXPECT_EQ(0, count);
+
+    EXPECT_EQ(0, address_ordered.emplace_and_return_index(0));
+    EXPECT_EQ(0, lowest_index.emplace_and_return_index(0));
+    for (int i = 0; i < 8; i++)
+    {
+        lifo.emplace_and_return_index(i);
+    }
+    EXPECT_TRUE(lifo.full());
+}
+
+TEST(FixedIndexBasedPoolStorage, CopyLiveFrom)
+{
+    FixedIndexBasedPoolStorage<MockNonTrivialInt, 8> storage{};
+    for (int i = 0; i < 5; i++)
+    {
+        storage.emplace_and_return_index(i);
+    }
+    storage.delete_at_and_return_repositioned_index(1);
+    storage.delete_at_and_return_repositioned_index(3);
+
+    FixedIndexBasedPoolStorage<MockNonTrivialInt, 8> copy{};
+    copy.copy_live_from(storage);
+    EXPECT_EQ(0, copy.at(0).value);
+    EXPECT_EQ(2, copy.at(2).value);
+    EXPECT_EQ(4, copy.at(4).value);
+    EXPECT_FALSE(copy.is_occupied(1));
+    // The free list matches too
+    EXPECT_EQ(3, copy.emplace_and_return_index(5));
+    EXPECT_EQ(1, copy.emplace_and_return_index(6));
+    copy.clear();
+    storage.clear();
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,306 @@
+#include "fixed_containers/fixed_indexed_priority_queue.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using IndexedPriorityQueueType = FixedIndexedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<IndexedPriorityQueueType>);
+static_assert(NotTrivial<IndexedPriorityQueueType>);
+static_assert(StandardLayout<IndexedPriorityQueueType>);
+static_assert(IsStructuralType<IndexedPriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<IndexedPriorityQueueType>);
+
+// Pops everything, in priority order
+template <typename QueueType>
+std::vector<int> drain(QueueType& queue)
+{
+    std::vector<int> out{};
+    while (!queue.empty())
+    {
+        out.push_back(queue.top());
+        queue.pop();
+    }
+    return out;
+}
+}  // namespace
+
+TEST(FixedIndexedPriorityQueue, DefaultConstructor)
+{
+    constexpr FixedIndexedPriorityQueue<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+    static_assert(max_size_v<FixedIndexedPriorityQueue<int, 8>> == 8);
+}
+
+TEST(FixedIndexedPriorityQueue, PushAndPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedIndexedPriorityQueue<int, 8> var{};
+        var.push(5);
+        const GenerationalIndex handle = var.push(2);
+        var.emplace(7);
+        var.pop();
+        var.update_priority(handle, 9);
+        return var;
+    }();
+    static_assert(VAL1.top() == 9);
+    static_assert(VAL1.size() == 2);
+
+    FixedIndexedPriorityQueue<int, 4> var1{};
+    const GenerationalIndex h2 = var1.push(2);
+    const GenerationalIndex h4 = var1.push(4);
+    const GenerationalIndex h3 = var1.push(3);
+    var1.push(1);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_EQ(4, var1.top());
+    EXPECT_EQ(h4, var1.top_handle());
+
+    // Handles follow their element through the heap
+    EXPECT_EQ(2, var1.at(h2));
+    EXPECT_EQ(3, var1[h3]);
+    var1.pop();
+    EXPECT_FALSE(var1.contains(h4));
+    EXPECT_EQ(h3, var1.top_handle());
+    EXPECT_EQ(2, var1.at(h2));
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), drain(var1));
+    EXPECT_FALSE(var1.contains(h2));
+}
+
+TEST(FixedIndexedPriorityQueue, PushExceedsCapacity)
+{
+    FixedIndexedPriorityQueue<int, 2> var1{};
+    var1.push(0);
+    var1.push(1);
+    EXPECT_DEATH(var1.push(2), "");
+}
+
+TEST(FixedIndexedPriorityQueue, PopAndTopOnEmpty)
+{
+    FixedIndexedPriorityQueue<int, 2> var1{};
+    EXPECT_DEATH(var1.pop(), "");
+    EXPECT_DEATH((void)var1.top(), "");
+    EXPECT_DEATH((void)var1.top_handle(), "");
+}
+
+TEST(FixedIndexedPriorityQueue, UpdatePriority)
+{
+    FixedIndexedPriorityQueue<int, 8, std::greater<int>> var1{};
+    std::array<GenerationalIndex, 6> handles{};
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        handles.at(i) = var1.push(static_cast<int>(i * 10));
+    }
+
+    // Decrease-key moves it up, to the top
+    var1.update_priority(handles[4], -1);
+    EXPECT_EQ(handles[4], var1.top_handle());
+    // Increase-key moves it down
+    var1.update_priority(handles[4], 25);
+    EXPECT_EQ(handles[0], var1.top_handle());
+    var1.update_priority(handles[0], 100);
+    EXPECT_EQ(handles[1], var1.top_handle());
+    // Unchanged
+    var1.update_priority(handles[1], 10);
+
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        EXPECT_TRUE(var1.contains(handles.at(i)));
+    }
+    EXPECT_EQ(25, var1.at(handles[4]));
+    EXPECT_EQ((std::vector<int>{10, 20, 25, 30, 50, 100}), drain(var1));
+}
+
+TEST(FixedIndexedPriorityQueue, Erase)
+{
+    FixedIndexedPriorityQueue<int, 8> var1{};
+    std::array<GenerationalIndex, 7> handles{};
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        handles.at(i) = var1.push(static_cast<int>(i));
+    }
+
+    EXPECT_EQ(1, var1.erase(handles[6]));  // The top
+    EXPECT_EQ(1, var1.erase(handles[2]));  // In the middle
+    EXPECT_EQ(0, var1.erase(handles[2]));
+    EXPECT_EQ(1, var1.erase(handles[0]));
+    EXPECT_FALSE(var1.contains(handles[2]));
+    EXPECT_EQ(4, var1.size());
+    EXPECT_EQ(3, var1.at(handles[3]));
+    EXPECT_EQ((std::vector<int>{5, 4, 3, 1}), drain(var1));
+}
+
+TEST(FixedIndexedPriorityQueue, StaleHandleAfterSlotReuse)
+{
+    FixedIndexedPriorityQueue<int, 4> var1{};
+    const GenerationalIndex handle1 = var1.push(1);
+    var1.pop();
+    const GenerationalIndex handle2 = var1.push(2);
+    EXPECT_EQ(handle1.index, handle2.index);
+    EXPECT_FALSE(var1.contains(handle1));
+    EXPECT_TRUE(var1.contains(handle2));
+    EXPECT_EQ(0, var1.erase(handle1));
+    EXPECT_DEATH((void)var1.at(handle1), "");
+    EXPECT_DEATH(var1.update_priority(handle1, 3), "");
+    EXPECT_FALSE(var1.contains(GenerationalIndex{}));
+}
+
+TEST(FixedIndexedPriorityQueue, Clear)
+{
+    FixedIndexedPriorityQueue<int, 4> var1{};
+    const GenerationalIndex handle1 = var1.push(1);
+    var1.push(2);
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_FALSE(var1.contains(handle1));
+    var1.push(3);
+    EXPECT_EQ(3, var1.top());
+}
+
+TEST(FixedIndexedPriorityQueue, RandomOperations)
+{
+    // Checked against a list of the live handles and their values
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> values{0, 1000};
+    FixedIndexedPriorityQueue<int, 64, std::less<int>, 3> var1{};
+    std::vector<std::pair<GenerationalIndex, int>> expected{};
+    const auto pick = [&]()
+    { return std::next(expected.begin(), values(generator) % std::ssize(expected)); };
+
+    for (int step = 0; step < 5000; step++)
+    {
+        const int operation = values(generator) % 4;
+        if (operation == 0 && !is_full(var1))
+        {
+            const int value = values(generator);
+            expected.emplace_back(var1.push(value), value);
+        }
+        else if (operation == 1 && !expected.empty())
+        {
+            const auto it = pick();
+            it->second = values(generator);
+            var1.update_priority(it->first, it->second);
+        }
+        else if (operation == 2 && !expected.empty())
+        {
+            const auto it = pick();
+            EXPECT_EQ(1, var1.erase(it->first));
+            expected.erase(it);
+        }
+        else if (!expected.empty())
+        {
+            const auto it = std::ranges::max_element(
+                expected, [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+            ASSERT_EQ(it->second, var1.top());
+            ASSERT_EQ(it->second, var1.at(var1.top_handle()));
+            var1.pop();
+            // Ties can be popped in any order
+            std::erase_if(expected,
+                          [&var1](const auto& entry) { return !var1.contains(entry.first); });
+        }
+
+        ASSERT_EQ(expected.size(), var1.size());
+        for (const auto& [handle, value] : expected)
+        {
+            ASSERT_EQ(value, var1.at(handle));
+        }
+    }
+}
+
+TEST(FixedIndexedPriorityQueue, ShortestPaths)
+{
+    // Dijkstra, with one queue entry per vertex whose distance is decreased in place
+    struct Edge
+    {
+        std::size_t to;
+        int weight;
+    };
+    const std::array<std::vector<Edge>, 5> graph{{
+        {{1, 10}, {2, 3}},
+        {{3, 2}},
+        {{1, 4}, {3, 8}, {4, 2}},
+        {{4, 5}},
+        {},
+    }};
+
+    struct Entry
+    {
+        int distance;
+        std::size_t vertex;
+        constexpr bool operator>(const Entry& other) const { return distance > other.distance; }
+    };
+    FixedIndexedPriorityQueue<Entry, 5, std::greater<Entry>> queue{};
+    std::array<GenerationalIndex, 5> handles{};
+    std::array<int, 5> distances{};
+    distances.fill(std::numeric_limits<int>::max());
+
+    distances[0] = 0;
+    handles[0] = queue.push({0, 0});
+    while (!queue.empty())
+    {
+        const Entry current = queue.top();
+        queue.pop();
+        for (const Edge& edge : graph.at(current.vertex))
+        {
+            const int distance = current.distance + edge.weight;
+            if (distance >= distances.at(edge.to))
+            {
+                continue;
+            }
+            distances.at(edge.to) = distance;
+            if (queue.contains(handles.at(edge.to)))
+            {
+                queue.update_priority(handles.at(edge.to), {distance, edge.to});
+            }
+            else
+            {
+                handles.at(edge.to) = queue.push({distance, edge.to});
+            }
+        }
+    }
+    EXPECT_EQ((std::array{0, 7, 3, 9, 5}), distances);
+}
+
+TEST(FixedIndexedPriorityQueue, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedIndexedPriorityQueue<InstanceCounterType, 8> var1{};
+        std::array<GenerationalIndex, 5> handles{};
+        for (std::size_t i = 0; i < handles.size(); i++)
+        {
+            handles.at(i) = var1.push(InstanceCounterType{static_cast<int>(i)});
+        }
+        EXPECT_EQ(5, InstanceCounterType::counter);
+        var1.pop();
+        EXPECT_EQ(4, InstanceCounterType::counter);
+        var1.erase(handles[1]);
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        var1.update_priority(handles[0], InstanceCounterType{7});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        EXPECT_EQ(7, var1.top().get());
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
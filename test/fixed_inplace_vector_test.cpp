@@ -0,0 +1,239 @@
+#include "fixed_containers/fixed_inplace_vector.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ArenaType = FixedInplaceVectorArena<int, 8, 2>;
+using VectorType = FixedInplaceVector<int, 2, ArenaType>;
+
+// Static assert for expected type properties
+static_assert(std::contiguous_iterator<VectorType::iterator>);
+static_assert(std::contiguous_iterator<VectorType::const_iterator>);
+static_assert(!TriviallyCopyable<VectorType>);
+
+// Each instance only pays for the inline buffer, the worst case is paid once per arena block
+static_assert(sizeof(FixedInplaceVector<int, 4, FixedInplaceVectorArena<int, 512, 16>>) <
+              sizeof(FixedVector<int, 512>) / 32);
+}  // namespace
+
+TEST(FixedInplaceVector, DefaultConstructor)
+{
+    ArenaType arena{};
+    const VectorType var1{arena};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_FALSE(var1.uses_arena());
+    EXPECT_EQ(2, var1.capacity());
+    EXPECT_EQ(8, var1.max_size());
+
+    // Without an arena, the inline buffer is all there is
+    VectorType var2{};
+    var2.push_back(0);
+    var2.push_back(1);
+    EXPECT_DEATH(var2.push_back(2), "");
+}
+
+TEST(FixedInplaceVector, PushBackMovesToArena)
+{
+    constexpr auto VAL1 = []()
+    {
+        ArenaType arena{};
+        VectorType var{arena};
+        for (int i = 0; i < 5; i++)
+        {
+            var.push_back(i);
+        }
+        FixedVector<int, 8> result{};
+        result.insert(result.cend(), var.cbegin(), var.cend());
+        return std::pair{result, arena.blocks_in_use()};
+    }();
+    static_assert(std::ranges::equal(VAL1.first, std::array{0, 1, 2, 3, 4}));
+    static_assert(VAL1.second == 1);
+
+    ArenaType arena{};
+    VectorType var{arena};
+    var.push_back(0);
+    var.push_back(1);
+    EXPECT_FALSE(var.uses_arena());
+    EXPECT_EQ(0, arena.blocks_in_use());
+
+    var.emplace_back(2);
+    EXPECT_TRUE(var.uses_arena());
+    EXPECT_EQ(8, var.capacity());
+    EXPECT_EQ(1, arena.blocks_in_use());
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 1, 2}));
+}
+
+TEST(FixedInplaceVector, ArenaExhaustion)
+{
+    ArenaType arena{};
+    VectorType var1{arena, {0, 1, 2}};
+    VectorType var2{arena, {0, 1, 2}};
+    EXPECT_TRUE(arena.full());
+
+    // Fits inline, so no block is needed
+    VectorType var3{arena, {0, 1}};
+    EXPECT_DEATH(var3.push_back(2), "");
+
+    // The block capacity is the hard limit
+    var1.resize(8);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.push_back(8), "");
+
+    // Released blocks are reused
+    var2.clear();
+    EXPECT_EQ(1, arena.blocks_in_use());
+    var3.push_back(2);
+    EXPECT_TRUE(var3.uses_arena());
+}
+
+TEST(FixedInplaceVector, ShrinkToFit)
+{
+    ArenaType arena{};
+    VectorType var{arena, {0, 1, 2, 3}};
+    var.shrink_to_fit();
+    EXPECT_TRUE(var.uses_arena());
+
+    var.pop_back();
+    var.pop_back();
+    var.shrink_to_fit();
+    EXPECT_FALSE(var.uses_arena());
+    EXPECT_EQ(0, arena.blocks_in_use());
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 1}));
+}
+
+TEST(FixedInplaceVector, InsertAndErase)
+{
+    constexpr auto VAL1 = []()
+    {
+        ArenaType arena{};
+        VectorType var{arena, {0, 3}};
+        auto it = var.insert(std::next(var.cbegin()), 2);
+        var.insert(it, 1);
+        var.erase(var.cbegin());
+        var.erase(std::next(var.cbegin()), var.cend());
+        return var.front();
+    }();
+    static_assert(VAL1 == 1);
+
+    ArenaType arena{};
+    VectorType var{arena, {0, 4}};
+    auto it = var.insert(std::next(var.cbegin()), 1);
+    EXPECT_EQ(1, *it);
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 1, 4}));
+    EXPECT_DEATH(var.erase(var.cend()), "");
+}
+
+TEST(FixedInplaceVector, SelfReferenceWhenMovingToArena)
+{
+    using StringArena = FixedInplaceVectorArena<std::string, 8, 3>;
+    using StringVector = FixedInplaceVector<std::string, 2, StringArena>;
+    // Long enough to not fit in the small string buffer
+    const std::string str0(40, 'a');
+    const std::string str1(40, 'b');
+
+    StringArena arena{};
+    StringVector var1{arena, {str0, str1}};
+    var1.push_back(var1[0]);
+    EXPECT_TRUE(var1.uses_arena());
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{str0, str1, str0}));
+
+    StringVector var2{arena, {str0, str1}};
+    var2.emplace_back(var2[1]);
+    EXPECT_TRUE(var2.uses_arena());
+    EXPECT_TRUE(std::ranges::equal(var2, std::array{str0, str1, str1}));
+
+    StringVector var3{arena, {str0, str1}};
+    auto it = var3.insert(std::next(var3.cbegin()), var3[0]);
+    EXPECT_EQ(str0, *it);
+    EXPECT_TRUE(var3.uses_arena());
+    EXPECT_TRUE(std::ranges::equal(var3, std::array{str0, str0, str1}));
+}
+
+TEST(FixedInplaceVector, Access)
+{
+    ArenaType arena{};
+    VectorType var{arena, {0, 1, 2}};
+    var[1] = 10;
+    EXPECT_EQ(10, var.at(1));
+    EXPECT_EQ(0, var.front());
+    EXPECT_EQ(2, var.back());
+    EXPECT_EQ(&var.front(), var.data());
+    EXPECT_TRUE(std::ranges::equal(var | std::views::reverse, std::array{2, 10, 0}));
+    EXPECT_DEATH((void)var.at(3), "");
+
+    var.clear();
+    EXPECT_DEATH((void)var.front(), "");
+    EXPECT_DEATH(var.pop_back(), "");
+}
+
+TEST(FixedInplaceVector, CopyAndMove)
+{
+    ArenaType arena{};
+    VectorType var1{arena, {0, 1, 2}};
+
+    // The copy borrows its own block
+    VectorType copy{var1};
+    EXPECT_EQ(2, arena.blocks_in_use());
+    EXPECT_EQ(var1, copy);
+
+    // The move takes over the block
+    const int* data = var1.data();
+    VectorType moved{std::move(var1)};
+    EXPECT_EQ(2, arena.blocks_in_use());
+    EXPECT_EQ(data, moved.data());
+
+    copy = VectorType{arena, {5}};
+    EXPECT_EQ(1, arena.blocks_in_use());
+    EXPECT_FALSE(copy.uses_arena());
+
+    moved = copy;
+    EXPECT_EQ(0, arena.blocks_in_use());
+    EXPECT_TRUE(std::ranges::equal(moved, std::array{5}));
+}
+
+TEST(FixedInplaceVector, EraseIf)
+{
+    ArenaType arena{};
+    VectorType var{arena, {0, 1, 2, 3, 4}};
+    EXPECT_EQ(2, erase_if(var, [](const int& entry) { return entry % 2 == 1; }));
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 2, 4}));
+}
+
+TEST(FixedInplaceVector, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    using CountingArena = FixedInplaceVectorArena<InstanceCounterType, 4, 1>;
+    InstanceCounterType::counter = 0;
+    {
+        CountingArena arena{};
+        FixedInplaceVector<InstanceCounterType, 1, CountingArena> var{arena};
+        var.emplace_back(0);
+        var.emplace_back(1);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+        var.pop_back();
+        EXPECT_EQ(1, InstanceCounterType::counter);
+        var.emplace_back(2);
+        var.clear();
+        EXPECT_EQ(0, InstanceCounterType::counter);
+        var.emplace_back(3);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
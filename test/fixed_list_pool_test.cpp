@@ -0,0 +1,303 @@
+#include "fixed_containers/fixed_list_pool.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+// Static assert for expected type properties
+namespace trivially_copyable_list_pool
+{
+using ListPoolType = FixedListPool<int, 5, 3>;
+static_assert(TriviallyCopyable<ListPoolType>);
+static_assert(NotTrivial<ListPoolType>);
+static_assert(StandardLayout<ListPoolType>);
+static_assert(IsStructuralType<ListPoolType>);
+
+static_assert(std::bidirectional_iterator<ListPoolType::iterator>);
+static_assert(std::bidirectional_iterator<ListPoolType::const_iterator>);
+}  // namespace trivially_copyable_list_pool
+
+namespace not_trivially_copyable_list_pool
+{
+using ListPoolType = FixedListPool<MockNonTrivialInt, 5, 3>;
+static_assert(!TriviallyCopyable<ListPoolType>);
+static_assert(NotTriviallyDestructible<ListPoolType>);
+}  // namespace not_trivially_copyable_list_pool
+
+}  // namespace
+
+TEST(FixedListPool, DefaultConstructor)
+{
+    constexpr FixedListPool<int, 8, 4> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+    static_assert(VAL1.list_count() == 4);
+    static_assert(VAL1.empty(3));
+}
+
+TEST(FixedListPool, PushAndPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedListPool<int, 8, 2> var{};
+        var.push_back(0, 1);
+        var.push_back(1, 10);
+        var.push_front(0, 0);
+        var.emplace_back(1, 11);
+        var.emplace_front(0, -1);
+        var.push_back(0, 2);
+        var.pop_front(0);
+        var.pop_back(1);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.size(0) == 3);
+    static_assert(VAL1.size(1) == 1);
+    static_assert(std::ranges::equal(VAL1.list(0), std::array{0, 1, 2}));
+    static_assert(std::ranges::equal(VAL1.list(1), std::array{10}));
+    static_assert(VAL1.front(0) == 0);
+    static_assert(VAL1.back(0) == 2);
+    static_assert(VAL1.front(1) == 10);
+}
+
+TEST(FixedListPool, CapacityIsShared)
+{
+    FixedListPool<int, 4, 3> var{};
+    // A single list can use the whole pool
+    for (int i = 0; i < 4; i++)
+    {
+        var.push_back(2, i);
+    }
+    EXPECT_TRUE(is_full(var));
+    EXPECT_DEATH(var.push_back(0, 4), "");
+
+    var.pop_front(2);
+    var.push_back(0, 4);
+    EXPECT_EQ(3, var.size(2));
+    EXPECT_EQ(1, var.size(0));
+    EXPECT_DEATH(var.push_back(1, 5), "");
+}
+
+TEST(FixedListPool, InvalidListId)
+{
+    FixedListPool<int, 4, 2> var{};
+    EXPECT_DEATH(var.push_back(2, 1), "");
+    EXPECT_DEATH(var.clear(2), "");
+    EXPECT_DEATH(var.front(0), "");
+    EXPECT_DEATH(var.pop_back(1), "");
+}
+
+TEST(FixedListPool, InsertAndErase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedListPool<int, 8, 2> var{};
+        var.push_back(1, 0);
+        var.push_back(1, 3);
+        auto it = var.insert(1, std::next(var.cbegin(1)), 1);
+        var.emplace(1, std::next(it), 2);
+        var.push_back(0, 5);
+        it = var.erase(1, var.cbegin(1));
+        return std::pair{var, *it};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first.list(1), std::array{1, 2, 3}));
+    static_assert(std::ranges::equal(VAL1.first.list(0), std::array{5}));
+    static_assert(VAL1.second == 1);
+
+    FixedListPool<int, 4, 2> var{};
+    EXPECT_DEATH(var.erase(0, var.cend(0)), "");
+}
+
+TEST(FixedListPool, IteratorMustBelongToTheList)
+{
+    FixedListPool<int, 8, 3> var{};
+    var.push_back(0, 1);
+    var.push_back(1, 2);
+    var.push_back(1, 3);
+
+    EXPECT_DEATH(var.erase(1, var.cbegin(0)), "");
+    EXPECT_DEATH(var.insert(0, var.cbegin(1), 4), "");
+    EXPECT_DEATH(var.emplace(2, var.cend(0), 4), "");
+    EXPECT_DEATH(var.splice(2, var.cend(2), 0, var.cbegin(1)), "");
+    EXPECT_DEATH(var.splice(2, var.cbegin(1), 1, var.cbegin(1)), "");
+    EXPECT_DEATH(var.splice(2, var.cend(0), 1), "");
+
+    // The sizes are untouched by the rejected operations
+    EXPECT_EQ(1, var.size(0));
+    EXPECT_EQ(2, var.size(1));
+    EXPECT_EQ(0, var.size(2));
+
+    // Spliced elements belong to their new list
+    var.splice(2, var.cend(2), 1);
+    EXPECT_DEATH(var.erase(1, var.cbegin(2)), "");
+    var.splice(0, var.cend(0), 2, var.cbegin(2));
+    EXPECT_DEATH(var.erase(2, std::next(var.cbegin(0))), "");
+    var.erase(0, std::next(var.cbegin(0)));
+    var.erase(2, var.cbegin(2));
+    EXPECT_EQ(1, var.size(0));
+    EXPECT_EQ(0, var.size(1));
+    EXPECT_EQ(0, var.size(2));
+}
+
+TEST(FixedListPool, SpliceOneElement)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedListPool<int, 8, 2> var{};
+        for (int i = 0; i < 4; i++)
+        {
+            var.push_back(0, i);
+        }
+        var.push_back(1, 10);
+        var.splice(1, var.cbegin(1), 0, std::next(var.cbegin(0), 2));
+        var.splice(0, var.cend(0), 0, var.cbegin(0));
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1.list(0), std::array{1, 3, 0}));
+    static_assert(std::ranges::equal(VAL1.list(1), std::array{2, 10}));
+    static_assert(VAL1.size(0) == 3);
+    static_assert(VAL1.size(1) == 2);
+
+    // Elements are relinked, not moved: iterators and addresses stay valid
+    FixedListPool<int, 8, 3> var{};
+    var.push_back(0, 7);
+    var.push_back(0, 8);
+    const int* address_of_seven = &var.front(0);
+    const auto it = var.begin(0);
+    var.splice(2, var.cend(2), 0, it);
+    EXPECT_EQ(address_of_seven, &var.front(2));
+    EXPECT_EQ(var.begin(2), it);
+    EXPECT_EQ(7, *it);
+    EXPECT_TRUE(std::ranges::equal(var.list(0), std::array{8}));
+    // The element now belongs to list 2 and iterates accordingly
+    EXPECT_EQ(var.end(2), std::next(it));
+
+    // Splicing an element in front of itself is a no-op
+    var.splice(0, var.cbegin(0), 0, var.cbegin(0));
+    EXPECT_EQ(1, var.size(0));
+    EXPECT_DEATH(var.splice(1, var.cend(1), 0, var.cend(0)), "");
+}
+
+TEST(FixedListPool, SpliceWholeList)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedListPool<int, 8, 3> var{};
+        var.push_back(0, 0);
+        var.push_back(0, 3);
+        var.push_back(1, 1);
+        var.push_back(1, 2);
+        var.splice(0, std::next(var.cbegin(0)), 1);
+        // Empty and self-splices are no-ops
+        var.splice(0, var.cbegin(0), 2);
+        var.splice(0, var.cbegin(0), 0);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1.list(0), std::array{0, 1, 2, 3}));
+    static_assert(VAL1.empty(1));
+    static_assert(VAL1.empty(2));
+    static_assert(VAL1.size() == 4);
+}
+
+TEST(FixedListPool, ReverseIteration)
+{
+    FixedListPool<int, 8, 2> var{};
+    var.push_back(1, 1);
+    var.push_back(1, 2);
+    var.push_back(1, 3);
+    EXPECT_TRUE(std::ranges::equal(var.list(1) | std::views::reverse, std::array{3, 2, 1}));
+}
+
+TEST(FixedListPool, RemoveIf)
+{
+    FixedListPool<int, 8, 2> var{};
+    for (int i = 0; i < 6; i++)
+    {
+        var.push_back(static_cast<std::size_t>(i % 2), i);
+    }
+    EXPECT_EQ(2, erase_if(var, 0, [](const int& entry) { return entry > 0; }));
+    EXPECT_TRUE(std::ranges::equal(var.list(0), std::array{0}));
+    EXPECT_TRUE(std::ranges::equal(var.list(1), std::array{1, 3, 5}));
+    EXPECT_EQ(4, var.size());
+}
+
+TEST(FixedListPool, Clear)
+{
+    FixedListPool<int, 4, 2> var{};
+    var.push_back(0, 1);
+    var.push_back(1, 2);
+    var.push_back(1, 3);
+
+    var.clear(1);
+    EXPECT_TRUE(var.empty(1));
+    EXPECT_EQ(1, var.size());
+
+    var.clear();
+    EXPECT_TRUE(var.empty());
+    EXPECT_TRUE(var.empty(0));
+    for (int i = 0; i < 4; i++)
+    {
+        var.push_back(0, i);
+    }
+    EXPECT_TRUE(std::ranges::equal(var.list(0), std::array{0, 1, 2, 3}));
+}
+
+TEST(FixedListPool, CopyAndMove)
+{
+    FixedListPool<MockNonTrivialInt, 4, 2> var{};
+    var.push_back(0, 1);
+    var.push_back(1, 2);
+    var.push_back(0, 3);
+    const auto values = [](const MockNonTrivialInt& entry) { return entry.value; };
+
+    const FixedListPool<MockNonTrivialInt, 4, 2> copy = var;
+    EXPECT_TRUE(std::ranges::equal(copy.list(0), std::array{1, 3}, {}, values));
+    EXPECT_TRUE(std::ranges::equal(copy.list(1), std::array{2}, {}, values));
+    EXPECT_EQ(3, copy.size());
+
+    FixedListPool<MockNonTrivialInt, 4, 2> moved = std::move(var);
+    EXPECT_TRUE(std::ranges::equal(moved.list(0), std::array{1, 3}, {}, values));
+    EXPECT_EQ(3, moved.size());
+}
+
+TEST(FixedListPool, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedListPool<InstanceCounterType, 5, 2> var{};
+        var.emplace_back(0);
+        var.emplace_back(0);
+        var.emplace_back(1);
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        // Splicing neither copies nor destroys
+        var.splice(1, var.cend(1), 0, var.cbegin(0));
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        var.pop_back(1);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+        var.clear(1);
+        EXPECT_EQ(1, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
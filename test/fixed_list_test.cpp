@@ -14,11 +14,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <list>
 #include <ranges>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -1116,6 +1118,176 @@ TEST(FixedList, Full)
     EXPECT_TRUE(is_full(VAL1));
 }
 
+TEST(FixedList, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{};
+        for (int i = 0; i < 8; i++)
+        {
+            var.push_front(i);
+        }
+        var.remove(3);
+        var.remove(6);
+        var.compact();
+        var.push_back(10);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{7, 5, 4, 2, 1, 0, 10}));
+
+    FixedList<MockNonTrivialInt, 8> var{};
+    for (int i = 0; i < 8; i++)
+    {
+        var.push_front(i);
+    }
+    var.remove(MockNonTrivialInt{3});
+    var.remove(MockNonTrivialInt{6});
+    var.compact();
+    EXPECT_TRUE(std::ranges::equal(var,
+                                   std::array{7, 5, 4, 2, 1, 0},
+                                   {},
+                                   [](const MockNonTrivialInt& entry) { return entry.value; }));
+    // Elements are laid out in list order
+    EXPECT_TRUE(std::ranges::is_sorted(
+        var, std::less<>{}, [](const MockNonTrivialInt& entry) { return &entry; }));
+
+    var.push_front(MockNonTrivialInt{8});
+    var.insert(std::next(var.begin(), 2), MockNonTrivialInt{9});
+    EXPECT_TRUE(std::ranges::equal(var,
+                                   std::array{8, 7, 9, 5, 4, 2, 1, 0},
+                                   {},
+                                   [](const MockNonTrivialInt& entry) { return entry.value; }));
+
+    FixedList<int, 4> empty_list{1, 2};
+    empty_list.clear();
+    empty_list.compact();
+    EXPECT_TRUE(empty_list.empty());
+    empty_list.push_back(3);
+    EXPECT_TRUE(std::ranges::equal(empty_list, std::array{3}));
+}
+
+TEST(FixedList, SpliceWithinList)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{0, 1, 2, 3, 4, 5};
+        var.splice(var.cbegin(), var, std::next(var.cbegin(), 3), std::next(var.cbegin(), 5));
+        var.splice(var.cend(), var, var.cbegin());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{4, 0, 1, 2, 5, 3}));
+
+    FixedList<int, 8> var{0, 1, 2, 3};
+    const int* address_of_three = &var.back();
+    auto it = std::prev(var.end());
+    var.splice(var.cbegin(), var, it);
+    EXPECT_TRUE(std::ranges::equal(var, std::array{3, 0, 1, 2}));
+    // Elements are relinked, not moved
+    EXPECT_EQ(address_of_three, &var.front());
+    EXPECT_EQ(var.begin(), it);
+
+    // Splicing a range to one of its own boundaries is a no-op
+    var.splice(var.cbegin(), var, var.cbegin(), std::next(var.cbegin(), 2));
+    var.splice(var.cend(), var, std::next(var.cbegin(), 2), var.cend());
+    EXPECT_TRUE(std::ranges::equal(var, std::array{3, 0, 1, 2}));
+}
+
+TEST(FixedList, SpliceFromOtherList)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{0, 1, 2};
+        FixedList<int, 8> other{10, 11, 12, 13};
+        var.splice(std::next(var.cbegin()), other, std::next(other.cbegin()), other.cend());
+        var.splice(var.cbegin(), other);
+        return std::pair{var, other};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{10, 0, 11, 12, 13, 1, 2}));
+    static_assert(VAL1.second.empty());
+
+    FixedList<MockMoveableButNotCopyable, 4> var{};
+    var.emplace_back();
+    FixedList<MockMoveableButNotCopyable, 4> other{};
+    other.emplace_back();
+    other.emplace_back();
+    var.splice(var.cend(), std::move(other), other.cbegin());
+    EXPECT_EQ(2, var.size());
+    EXPECT_EQ(1, other.size());
+}
+
+TEST(FixedList, SpliceExceedsCapacity)
+{
+    FixedList<int, 4> var{0, 1, 2};
+    FixedList<int, 4> other{10, 11};
+    EXPECT_DEATH(var.splice(var.cend(), other), "");
+}
+
+TEST(FixedList, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 10> var{1, 3, 5, 7};
+        FixedList<int, 10> other{0, 2, 3, 8, 9};
+        var.merge(other);
+        return std::pair{var, other};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{0, 1, 2, 3, 3, 5, 7, 8, 9}));
+    static_assert(VAL1.second.empty());
+
+    // Elements of the destination stay in place; equal elements from `other` go after them
+    FixedList<std::pair<int, int>, 10> var{{3, 0}, {1, 0}};
+    FixedList<std::pair<int, int>, 10> other{{3, 1}, {2, 1}, {1, 1}};
+    const std::pair<int, int>* address_of_front = &var.front();
+    const auto descending_by_first = [](const auto& lhs, const auto& rhs)
+    { return lhs.first > rhs.first; };
+    var.merge(std::move(other), descending_by_first);
+    EXPECT_TRUE((std::ranges::equal(
+        var, std::array<std::pair<int, int>, 5>{{{3, 0}, {3, 1}, {2, 1}, {1, 0}, {1, 1}}})));
+    EXPECT_EQ(address_of_front, &var.front());
+
+    FixedList<int, 3> small{1, 2};
+    FixedList<int, 3> small_other{0, 3};
+    EXPECT_DEATH(small.merge(small_other), "");
+}
+
+TEST(FixedList, Sort)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedList<int, 8> var{5, 2, 7, 2, 0, 9, 1};
+        var.sort();
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 2, 5, 7, 9}));
+
+    for (std::size_t length = 0; length <= 17; length++)
+    {
+        FixedList<std::pair<int, std::size_t>, 17> var{};
+        for (std::size_t i = 0; i < length; i++)
+        {
+            var.push_back({static_cast<int>((i * 7) % 5), i});
+        }
+        const std::pair<int, std::size_t>* address_of_front = length > 0 ? &var.front() : nullptr;
+
+        std::vector<std::pair<int, std::size_t>> expected(var.begin(), var.end());
+        std::ranges::stable_sort(expected, std::greater<>{}, &std::pair<int, std::size_t>::first);
+        var.sort([](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+        EXPECT_TRUE(std::ranges::equal(var, expected));
+        EXPECT_TRUE(std::ranges::equal(var | std::views::reverse, expected | std::views::reverse));
+        if (length > 0)
+        {
+            // Relinked, not moved
+            EXPECT_EQ(0, address_of_front->second);
+        }
+    }
+}
+
 TEST(FixedList, Clear)
 {
     constexpr auto VAL1 = []()
@@ -8,6 +8,7 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -612,6 +613,86 @@ TEST(FixedMap, Clear)
     static_assert(VAL1.empty());
 }
 
+TEST(FixedMap, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{};
+        for (int i = 9; i >= 0; i--)
+        {
+            var[i] = i * 10;
+        }
+        var.erase(1);
+        var.erase(6);
+        var.compact();
+        var[6] = 60;
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 9);
+    static_assert(VAL1.at(6) == 60);
+    static_assert(VAL1.at(9) == 90);
+
+    FixedMap<int, MockNonTrivialInt, 16> var{};
+    for (int i = 0; i < 16; i++)
+    {
+        var.try_emplace((i * 7) % 16, i);
+    }
+    for (int i = 0; i < 16; i += 3)
+    {
+        var.erase(i);
+    }
+    var.compact();
+
+    EXPECT_EQ(10, var.size());
+    EXPECT_TRUE(
+        std::ranges::is_sorted(var, std::less<>{}, [](const auto& pair) { return pair.first; }));
+    for (const auto& [key, value] : var)
+    {
+        EXPECT_EQ(key, (value.value * 7) % 16);
+    }
+    // Entries are laid out in key order
+    EXPECT_TRUE(
+        std::ranges::is_sorted(var, std::less<>{}, [](const auto& pair) { return &pair.second; }));
+
+    var.try_emplace(0, 0);
+    var.erase(2);
+    EXPECT_EQ(10, var.size());
+    EXPECT_EQ(0, var.at(0).value);
+}
+
+TEST(FixedMap, GenerationalPoolStorage)
+{
+    using MapType =
+        FixedMap<int,
+                 MockNonTrivialInt,
+                 10,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedGenerationalPoolStorage>;
+
+    MapType var1{};
+    for (int i = 0; i < 8; i++)
+    {
+        var1.try_emplace(i, i * 10);
+    }
+    var1.erase(2);
+    var1.erase(5);
+
+    MapType var2{var1};
+    var2.compact();
+    EXPECT_EQ(6, var2.size());
+    EXPECT_EQ(70, var2.at(7).value);
+
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    var1 = var2;
+    var1.try_emplace(2, 20);
+    EXPECT_EQ(7, var1.size());
+    EXPECT_EQ(20, var1.at(2).value);
+    EXPECT_EQ(60, var1.at(6).value);
+}
+
 TEST(FixedMap, Erase)
 {
     constexpr auto VAL1 = []()
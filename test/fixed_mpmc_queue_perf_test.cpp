@@ -0,0 +1,123 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+#include "fixed_containers/fixed_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 1024;
+constexpr std::size_t BATCH_SIZE = 8;
+constexpr int MAX_THREAD_COUNT = 16;
+
+using Message = std::array<std::uint64_t, 4>;
+
+// The baseline: a FixedQueue shared by all threads behind a mutex
+class MutexGuardedQueue
+{
+    std::mutex mutex_{};
+    FixedQueue<Message, CAP> queue_{};
+
+public:
+    bool try_push(const Message& value)
+    {
+        const std::scoped_lock lock{mutex_};
+        if (is_full(queue_))
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+    std::size_t try_push_n(const std::span<const Message> values)
+    {
+        const std::scoped_lock lock{mutex_};
+        const std::size_t count = (std::min)(values.size(), CAP - queue_.size());
+        queue_.push_n(values.first(count));
+        return count;
+    }
+    bool try_pop(Message& out)
+    {
+        const std::scoped_lock lock{mutex_};
+        if (queue_.empty())
+        {
+            return false;
+        }
+        out = queue_.front();
+        queue_.pop();
+        return true;
+    }
+    std::size_t try_pop_n(const std::span<Message> out)
+    {
+        const std::scoped_lock lock{mutex_};
+        return queue_.pop_n(out);
+    }
+};
+
+// Every thread is both a producer and a consumer: it pushes one message and then pops one
+// (not necessarily its own), so the queue never fills up and contention grows with the thread
+// count
+template <typename QueueType>
+void benchmark_push_pop(benchmark::State& state)
+{
+    static QueueType queue{};
+    Message message{};
+    message[0] = static_cast<std::uint64_t>(state.thread_index());
+    for (auto _ : state)
+    {
+        while (!queue.try_push(message))
+        {
+        }
+        while (!queue.try_pop(message))
+        {
+        }
+        benchmark::DoNotOptimize(message);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Same as above, with `BATCH_SIZE` messages per call
+template <typename QueueType>
+void benchmark_push_pop_n(benchmark::State& state)
+{
+    static QueueType queue{};
+    std::array<Message, BATCH_SIZE> batch{};
+    for (auto _ : state)
+    {
+        for (std::size_t pushed_count = 0; pushed_count < BATCH_SIZE;)
+        {
+            pushed_count += queue.try_push_n(std::span<const Message>{batch}.subspan(pushed_count));
+        }
+        for (std::size_t popped_count = 0; popped_count < BATCH_SIZE;)
+        {
+            popped_count += queue.try_pop_n(std::span<Message>{batch}.subspan(popped_count));
+        }
+        benchmark::DoNotOptimize(batch);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH_SIZE));
+}
+
+BENCHMARK(benchmark_push_pop<MutexGuardedQueue>)->ThreadRange(1, MAX_THREAD_COUNT)->UseRealTime();
+BENCHMARK(benchmark_push_pop<FixedMpmcQueue<Message, CAP>>)
+    ->ThreadRange(1, MAX_THREAD_COUNT)
+    ->UseRealTime();
+
+BENCHMARK(benchmark_push_pop_n<MutexGuardedQueue>)
+    ->ThreadRange(1, MAX_THREAD_COUNT)
+    ->UseRealTime();
+BENCHMARK(benchmark_push_pop_n<FixedMpmcQueue<Message, CAP>>)
+    ->ThreadRange(1, MAX_THREAD_COUNT)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
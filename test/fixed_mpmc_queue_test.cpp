@@ -0,0 +1,234 @@
+#include "fixed_containers/fixed_mpmc_queue.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using MpmcQueueType = FixedMpmcQueue<int, 8>;
+static_assert(StandardLayout<MpmcQueueType>);
+static_assert(TriviallyDestructible<MpmcQueueType>);
+static_assert(NotCopyConstructible<MpmcQueueType>);
+static_assert(NotMoveConstructible<MpmcQueueType>);
+
+// The producer and consumer counters must not share a cache line
+static_assert(offsetof(MpmcQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_dequeue_position_) -
+                  offsetof(MpmcQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_enqueue_position_) >=
+              memory::CACHE_LINE_SIZE);
+}  // namespace
+
+TEST(FixedMpmcQueue, DefaultConstructor)
+{
+    const FixedMpmcQueue<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(8, var1.max_size());
+    static_assert(FixedMpmcQueue<int, 8>::static_max_size() == 8);
+}
+
+TEST(FixedMpmcQueue, PushAndPop)
+{
+    FixedMpmcQueue<int, 4> var1{};
+    EXPECT_TRUE(var1.try_push(1));
+    const int value = 2;
+    EXPECT_TRUE(var1.try_push(value));
+    EXPECT_TRUE(var1.try_emplace(3));
+    var1.push(4);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_FALSE(var1.try_push(5));
+
+    int out = 0;
+    for (int i = 1; i <= 4; i++)
+    {
+        EXPECT_TRUE(var1.try_pop(out));
+        EXPECT_EQ(i, out);
+    }
+    EXPECT_FALSE(var1.try_pop(out));
+    EXPECT_EQ(4, out);
+    EXPECT_TRUE(var1.empty());
+
+    // Several laps around the storage
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(var1.try_push(i));
+        EXPECT_TRUE(var1.try_push(i + 1));
+        EXPECT_TRUE(var1.try_pop(out));
+        EXPECT_EQ(i, out);
+        EXPECT_TRUE(var1.try_pop(out));
+        EXPECT_EQ(i + 1, out);
+    }
+}
+
+TEST(FixedMpmcQueue, PushExceedsCapacity)
+{
+    FixedMpmcQueue<int, 2> var1{};
+    var1.push(0);
+    var1.push(1);
+    EXPECT_DEATH(var1.push(2), "");
+    EXPECT_DEATH(var1.push_n(std::array{2}), "");
+}
+
+namespace
+{
+struct CountingChecking
+{
+    static inline std::size_t length_error_count = 0;
+
+    static void out_of_range(const std::size_t /*index*/,
+                             const std::size_t /*size*/,
+                             const std_transition::source_location& /*loc*/)
+    {
+    }
+    static void length_error(const std::size_t /*target_capacity*/,
+                             const std_transition::source_location& /*loc*/)
+    {
+        length_error_count++;
+    }
+    static void empty_container_access(const std_transition::source_location& /*loc*/) {}
+    static void invalid_argument(const StringLiteral& /*error_message*/,
+                                 const std_transition::source_location& /*loc*/)
+    {
+    }
+};
+}  // namespace
+
+TEST(FixedMpmcQueue, PushExceedsCapacityWithNonAbortingChecking)
+{
+    CountingChecking::length_error_count = 0;
+    FixedMpmcQueue<int, 2, CountingChecking> var1{};
+    var1.push(0);
+    // Pushes what fits, reports the rest once and returns instead of retrying
+    var1.push_n(std::array{1, 2, 3});
+    EXPECT_EQ(1, CountingChecking::length_error_count);
+    EXPECT_EQ(2, var1.size());
+    var1.push(4);
+    EXPECT_EQ(2, CountingChecking::length_error_count);
+}
+
+TEST(FixedMpmcQueue, PushNAndPopN)
+{
+    FixedMpmcQueue<int, 8> var1{};
+    EXPECT_EQ(6, var1.try_push_n(std::array{0, 1, 2, 3, 4, 5}));
+    std::array<int, 4> out1{};
+    EXPECT_EQ(4, var1.try_pop_n(out1));
+    EXPECT_EQ((std::array{0, 1, 2, 3}), out1);
+
+    // Only as many as fit are pushed, across the end of the storage
+    EXPECT_EQ(6, var1.try_push_n(std::array{6, 7, 8, 9, 10, 11, 12, 13}));
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_EQ(0, var1.try_push_n(std::array{14}));
+
+    std::array<int, 10> out2{};
+    EXPECT_EQ(8, var1.try_pop_n(out2));
+    EXPECT_EQ((std::array{4, 5, 6, 7, 8, 9, 10, 11, 0, 0}), out2);
+    EXPECT_EQ(0, var1.try_pop_n(out2));
+
+    var1.push_n(std::array{20, 21, 22});
+    EXPECT_EQ(3, var1.size());
+}
+
+TEST(FixedMpmcQueue, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedMpmcQueue<InstanceCounterType, 4> var1{};
+        var1.try_emplace(1);
+        var1.try_push_n(std::array<InstanceCounterType, 2>{2, 3});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        InstanceCounterType out{};
+        var1.try_pop(out);
+        EXPECT_EQ(1, out.get());
+        EXPECT_EQ(3, InstanceCounterType::counter);
+    }
+    // The remaining elements are destroyed along with the queue
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedMpmcQueue, ManyProducersAndConsumers)
+{
+    static constexpr std::size_t THREAD_COUNT = 4;
+    static constexpr std::uint64_t MESSAGES_PER_PRODUCER = 20'000;
+    FixedMpmcQueue<std::uint64_t, 64> var1{};
+    std::atomic<std::uint64_t> popped_count{0};
+    std::atomic<std::uint64_t> popped_sum{0};
+
+    std::vector<std::thread> threads{};
+    for (std::size_t t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.emplace_back(
+            [&var1, t]()
+            {
+                // Alternate between single and batched pushes, and give up the time slice while
+                // the queue is full so that a single core is not spent spinning
+                std::uint64_t next = 0;
+                while (next < MESSAGES_PER_PRODUCER)
+                {
+                    std::size_t pushed_count = 0;
+                    if (t % 2 == 0)
+                    {
+                        pushed_count = var1.try_push(next + 1) ? 1U : 0U;
+                    }
+                    else
+                    {
+                        const std::array<std::uint64_t, 2> batch{next + 1, next + 2};
+                        const std::size_t batch_size =
+                            next + 2 <= MESSAGES_PER_PRODUCER ? batch.size() : 1;
+                        pushed_count = var1.try_push_n(std::span{batch}.first(batch_size));
+                    }
+                    if (pushed_count == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    next += pushed_count;
+                }
+            });
+        threads.emplace_back(
+            [&var1, &popped_count, &popped_sum, t]()
+            {
+                std::array<std::uint64_t, 3> out{};
+                while (popped_count.load() < THREAD_COUNT * MESSAGES_PER_PRODUCER)
+                {
+                    const std::size_t count =
+                        t % 2 == 0 ? (var1.try_pop(out[0]) ? 1U : 0U) : var1.try_pop_n(out);
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        popped_sum += out.at(i);
+                    }
+                    popped_count += count;
+                    if (count == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(THREAD_COUNT * MESSAGES_PER_PRODUCER, popped_count.load());
+    EXPECT_EQ(THREAD_COUNT * MESSAGES_PER_PRODUCER * (MESSAGES_PER_PRODUCER + 1) / 2,
+              popped_sum.load());
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,212 @@
+#include "fixed_containers/fixed_priority_queue.hpp"
+#include "fixed_containers/fixed_set.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 8192;
+
+// Keys are kept unique, so that `FixedSet` can hold them too: a random priority in the upper
+// bits and a sequence number in the lower ones
+class KeyGenerator
+{
+    std::mt19937_64 generator_{42};
+    std::uint64_t sequence_number_{0};
+
+public:
+    // `base` lets the "hold" benchmarks schedule every new key after the current top, like a
+    // timer being rearmed
+    std::uint64_t next(const std::uint64_t base = 0)
+    {
+        const std::uint64_t priority = (base >> 20U) + (generator_() % 1024U);
+        return (priority << 20U) | (sequence_number_++ & 0xFFFFFU);
+    }
+};
+
+// All queues are min-queues, like a timer queue
+template <std::size_t ARITY>
+class HeapQueue
+{
+    FixedPriorityQueue<std::uint64_t, CAP, std::greater<>, ARITY> queue_{};
+
+public:
+    HeapQueue() = default;
+    explicit HeapQueue(const std::vector<std::uint64_t>& values)
+      : queue_{values.begin(), values.end()}
+    {
+    }
+
+    void push(const std::uint64_t value) { queue_.push(value); }
+    [[nodiscard]] std::uint64_t top() const { return queue_.top(); }
+    void pop() { queue_.pop(); }
+    std::uint64_t push_pop(const std::uint64_t value) { return queue_.push_pop(value); }
+};
+
+// What `FixedPriorityQueue` replaces: a `FixedSet` used as a heap
+class SetQueue
+{
+    FixedSet<std::uint64_t, CAP> set_{};
+
+public:
+    SetQueue() = default;
+    explicit SetQueue(const std::vector<std::uint64_t>& values)
+      : set_{values.begin(), values.end()}
+    {
+    }
+
+    void push(const std::uint64_t value) { set_.insert(value); }
+    [[nodiscard]] std::uint64_t top() const { return *set_.begin(); }
+    void pop() { set_.erase(set_.begin()); }
+    std::uint64_t push_pop(const std::uint64_t value)
+    {
+        const std::uint64_t old_top = top();
+        pop();
+        push(value);
+        return old_top;
+    }
+};
+
+class StdQueue
+{
+    std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>> queue_{};
+
+public:
+    StdQueue() = default;
+    explicit StdQueue(const std::vector<std::uint64_t>& values)
+      : queue_{values.begin(), values.end()}
+    {
+    }
+
+    void push(const std::uint64_t value) { queue_.push(value); }
+    [[nodiscard]] std::uint64_t top() const { return queue_.top(); }
+    void pop() { queue_.pop(); }
+    std::uint64_t push_pop(const std::uint64_t value)
+    {
+        const std::uint64_t old_top = top();
+        pop();
+        push(value);
+        return old_top;
+    }
+};
+
+std::vector<std::uint64_t> make_keys(const std::size_t count)
+{
+    KeyGenerator keys{};
+    std::vector<std::uint64_t> out(count);
+    for (std::uint64_t& key : out)
+    {
+        key = keys.next();
+    }
+    return out;
+}
+
+// Push `state.range(0)` elements one at a time, then pop them all
+template <typename QueueType>
+void benchmark_push_then_pop_all(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> values = make_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const auto queue = std::make_unique<QueueType>();
+        for (const std::uint64_t value : values)
+        {
+            queue->push(value);
+        }
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            benchmark::DoNotOptimize(queue->top());
+            queue->pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Build a queue out of `state.range(0)` elements, which is a heapify for the heaps
+template <typename QueueType>
+void benchmark_construct_from_range(benchmark::State& state)
+{
+    const std::vector<std::uint64_t> values = make_keys(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const auto queue = std::make_unique<QueueType>(values);
+        benchmark::DoNotOptimize(queue->top());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The "hold" model of a timer queue at a steady size of `state.range(0)`: the earliest element
+// is removed and a later one is added
+template <typename QueueType>
+void benchmark_hold(benchmark::State& state)
+{
+    const auto queue =
+        std::make_unique<QueueType>(make_keys(static_cast<std::size_t>(state.range(0))));
+    KeyGenerator keys{};
+    for (auto _ : state)
+    {
+        const std::uint64_t earliest = queue->top();
+        queue->pop();
+        queue->push(keys.next(earliest));
+        benchmark::DoNotOptimize(earliest);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Same as above, with `push_pop()`
+template <typename QueueType>
+void benchmark_hold_push_pop(benchmark::State& state)
+{
+    const auto queue =
+        std::make_unique<QueueType>(make_keys(static_cast<std::size_t>(state.range(0))));
+    KeyGenerator keys{};
+    for (auto _ : state)
+    {
+        const std::uint64_t earliest = queue->push_pop(keys.next(queue->top()));
+        benchmark::DoNotOptimize(earliest);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+constexpr std::int64_t MIN_SIZE = 64;
+constexpr std::int64_t MAX_SIZE = static_cast<std::int64_t>(CAP);
+
+BENCHMARK(benchmark_push_then_pop_all<SetQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_push_then_pop_all<StdQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_push_then_pop_all<HeapQueue<2>>)
+    ->RangeMultiplier(8)
+    ->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_push_then_pop_all<HeapQueue<4>>)
+    ->RangeMultiplier(8)
+    ->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_push_then_pop_all<HeapQueue<8>>)
+    ->RangeMultiplier(8)
+    ->Range(MIN_SIZE, MAX_SIZE);
+
+BENCHMARK(benchmark_construct_from_range<SetQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_construct_from_range<StdQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_construct_from_range<HeapQueue<4>>)
+    ->RangeMultiplier(8)
+    ->Range(MIN_SIZE, MAX_SIZE);
+
+BENCHMARK(benchmark_hold<SetQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_hold<StdQueue>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_hold<HeapQueue<2>>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_hold<HeapQueue<4>>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_hold<HeapQueue<8>>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(benchmark_hold_push_pop<HeapQueue<4>>)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE);
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,210 @@
+#include "fixed_containers/fixed_priority_queue.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using PriorityQueueType = FixedPriorityQueue<int, 5>;
+static_assert(TriviallyCopyable<PriorityQueueType>);
+static_assert(NotTrivial<PriorityQueueType>);
+static_assert(StandardLayout<PriorityQueueType>);
+static_assert(IsStructuralType<PriorityQueueType>);
+static_assert(ConstexprDefaultConstructible<PriorityQueueType>);
+
+// Pops everything, in priority order
+template <typename PriorityQueueType>
+std::vector<int> drain(PriorityQueueType& priority_queue)
+{
+    std::vector<int> out{};
+    while (!priority_queue.empty())
+    {
+        out.push_back(priority_queue.top());
+        priority_queue.pop();
+    }
+    return out;
+}
+
+// Values closer to `target` have a higher priority
+struct ClosestFirst
+{
+    int target;
+
+    constexpr bool operator()(const int lhs, const int rhs) const
+    {
+        return std::abs(lhs - target) > std::abs(rhs - target);
+    }
+};
+
+template <std::size_t ARITY>
+void test_against_sorting()
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, 50};
+
+    std::vector<int> values(200);
+    std::generate(values.begin(), values.end(), [&]() { return distribution(generator); });
+
+    FixedPriorityQueue<int, 200, std::less<int>, ARITY> var1{};
+    for (const int value : values)
+    {
+        var1.push(value);
+    }
+    FixedPriorityQueue<int, 200, std::less<int>, ARITY> var2{values.begin(), values.end()};
+
+    std::sort(values.begin(), values.end(), std::greater<>{});
+    EXPECT_EQ(values, drain(var1));
+    EXPECT_EQ(values, drain(var2));
+}
+}  // namespace
+
+TEST(FixedPriorityQueue, DefaultConstructor)
+{
+    constexpr FixedPriorityQueue<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.size() == 0);
+}
+
+TEST(FixedPriorityQueue, IteratorConstructor)
+{
+    constexpr FixedPriorityQueue<int, 8> VAL1 = []()
+    {
+        const std::array<int, 6> values{3, 8, 1, 9, 4, 9};
+        return FixedPriorityQueue<int, 8>{values.begin(), values.end()};
+    }();
+    static_assert(VAL1.top() == 9);
+    static_assert(VAL1.size() == 6);
+
+    const std::array<int, 6> values{3, 8, 1, 9, 4, 9};
+    FixedPriorityQueue<int, 8> var1{values.begin(), values.end()};
+    EXPECT_EQ((std::vector<int>{9, 9, 8, 4, 3, 1}), drain(var1));
+}
+
+TEST(FixedPriorityQueue, MaxSize)
+{
+    static_assert(FixedPriorityQueue<int, 3>::static_max_size() == 3);
+    static_assert(max_size_v<FixedPriorityQueue<int, 3>> == 3);
+    const FixedPriorityQueue<int, 3> var1{};
+    EXPECT_EQ(3, var1.max_size());
+}
+
+TEST(FixedPriorityQueue, PushAndPop)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedPriorityQueue<int, 8> var{};
+        var.push(5);
+        var.push(2);
+        var.emplace(7);
+        var.push(1);
+        var.pop();
+        return var;
+    }();
+    static_assert(VAL1.top() == 5);
+    static_assert(VAL1.size() == 3);
+
+    FixedPriorityQueue<int, 4> var1{};
+    var1.push(2);
+    var1.push(4);
+    var1.push(3);
+    var1.push(1);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_EQ(4, var1.top());
+    EXPECT_EQ((std::vector<int>{4, 3, 2, 1}), drain(var1));
+}
+
+TEST(FixedPriorityQueue, PushExceedsCapacity)
+{
+    FixedPriorityQueue<int, 2> var1{};
+    var1.push(0);
+    var1.push(1);
+    EXPECT_DEATH(var1.push(2), "");
+}
+
+TEST(FixedPriorityQueue, PopAndTopOnEmpty)
+{
+    FixedPriorityQueue<int, 2> var1{};
+    EXPECT_DEATH(var1.pop(), "");
+    EXPECT_DEATH((void)var1.top(), "");
+}
+
+TEST(FixedPriorityQueue, CustomComparator)
+{
+    FixedPriorityQueue<int, 8, std::greater<int>> var1{};
+    for (const int value : {4, 1, 3, 2})
+    {
+        var1.push(value);
+    }
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), drain(var1));
+
+    // A comparator with state
+    FixedPriorityQueue<int, 8, ClosestFirst> var2{ClosestFirst{10}};
+    for (const int value : {1, 8, 20, 13})
+    {
+        var2.push(value);
+    }
+    EXPECT_EQ((std::vector<int>{8, 13, 1, 20}), drain(var2));
+}
+
+TEST(FixedPriorityQueue, PushPop)
+{
+    FixedPriorityQueue<int, 3> var1{};
+    // Nothing to compare against
+    EXPECT_EQ(5, var1.push_pop(5));
+    EXPECT_TRUE(var1.empty());
+
+    var1.push(6);
+    var1.push(4);
+    var1.push(2);
+    // Works on a full queue, and leaves it untouched when the new value would be the top
+    EXPECT_EQ(7, var1.push_pop(7));
+    EXPECT_EQ(6, var1.push_pop(6));
+    EXPECT_EQ(6, var1.push_pop(3));
+    EXPECT_EQ((std::vector<int>{4, 3, 2}), drain(var1));
+}
+
+TEST(FixedPriorityQueue, Arity)
+{
+    test_against_sorting<2>();
+    test_against_sorting<3>();
+    test_against_sorting<4>();
+    test_against_sorting<8>();
+}
+
+TEST(FixedPriorityQueue, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedPriorityQueue<InstanceCounterType, 8> var1{};
+        for (const int value : {3, 1, 4, 1, 5})
+        {
+            var1.push(InstanceCounterType{value});
+        }
+        EXPECT_EQ(5, InstanceCounterType::counter);
+        var1.pop();
+        EXPECT_EQ(4, InstanceCounterType::counter);
+        EXPECT_EQ(4, var1.top().get());
+        EXPECT_EQ(9, var1.push_pop(InstanceCounterType{9}).get());
+        EXPECT_EQ(4, InstanceCounterType::counter);
+        EXPECT_EQ(4, var1.push_pop(InstanceCounterType{2}).get());
+        EXPECT_EQ(4, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
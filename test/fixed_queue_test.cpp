@@ -7,6 +7,10 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -157,6 +161,79 @@ TEST(FixedQueue, Pop)
     static_assert(VAL1.size() == 1);
 }
 
+TEST(FixedQueue, PushNAndPopN)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedQueue<int, 5> var{};
+        var.push(1);
+        const std::array<int, 3> values{2, 3, 4};
+        var.push_n(values);
+        std::array<int, 2> out{};
+        const std::size_t popped_count = var.pop_n(out);
+        return std::pair{var, std::pair{out, popped_count}};
+    }();
+    static_assert(VAL1.first.size() == 2);
+    static_assert(VAL1.first.front() == 3);
+    static_assert(VAL1.second.first == std::array{1, 2});
+    static_assert(VAL1.second.second == 2);
+
+    // Both calls go across the end of the storage
+    FixedQueue<int, 5> var1{};
+    var1.push_n(std::array{0, 1, 2, 3});
+    std::array<int, 3> out1{};
+    EXPECT_EQ(3, var1.pop_n(out1));
+    var1.push_n(std::array{4, 5, 6, 7});
+    EXPECT_TRUE(is_full(var1));
+
+    std::array<int, 8> out2{};
+    EXPECT_EQ(5, var1.pop_n(out2));
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ((std::array{3, 4, 5, 6, 7, 0, 0, 0}), out2);
+    EXPECT_EQ(0, var1.pop_n(out2));
+}
+
+TEST(FixedQueue, PushNExceedsCapacity)
+{
+    FixedQueue<int, 3> var1{};
+    var1.push(0);
+    EXPECT_DEATH(var1.push_n(std::array{1, 2, 3}), "");
+}
+
+TEST(FixedQueue, Consume)
+{
+    FixedQueue<int, 5> var1{};
+    var1.push_n(std::array{0, 1, 2});
+    var1.pop();
+    var1.pop();
+    var1.push_n(std::array{3, 4, 5});  // {2, 3, 4, 5}, wrapping after 4
+
+    std::vector<std::size_t> segment_sizes{};
+    int sum = 0;
+    const std::size_t consumed_count = var1.consume(4,
+                                                    [&](const std::span<int> segment)
+                                                    {
+                                                        segment_sizes.push_back(segment.size());
+                                                        for (const int entry : segment)
+                                                        {
+                                                            sum += entry;
+                                                        }
+                                                    });
+    EXPECT_EQ(4, consumed_count);
+    EXPECT_EQ(14, sum);
+    EXPECT_EQ((std::vector<std::size_t>{3, 1}), segment_sizes);
+    EXPECT_TRUE(var1.empty());
+
+    var1.push(6);
+    var1.push(7);
+
+    EXPECT_EQ(1, var1.consume(1, [](const std::span<int> /*segment*/) {}));
+    EXPECT_EQ(7, var1.front());
+    EXPECT_EQ(1, var1.consume(10, [](const std::span<int> /*segment*/) {}));
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.consume(10, [](const std::span<int> /*segment*/) { FAIL(); }));
+}
+
 TEST(FixedQueue, Equality)
 {
     static constexpr std::array<int, 2> ENTRY_A1{1, 2};
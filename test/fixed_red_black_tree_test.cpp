@@ -16,10 +16,13 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <optional>
 #include <queue>
 #include <random>
 #include <tuple>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -51,6 +54,41 @@ using Storage_1 = FixedRedBlackTreeStorage<int,
 static_assert(IsFixedRedBlackTreeStorage<Storage_1>);
 static_assert(IsStructuralType<Storage_1>);
 
+// A custom storage that only provides the per-entry operations
+template <typename T, std::size_t MAXIMUM_SIZE>
+class PerEntryOnlyStorage
+{
+public:
+    using size_type = typename FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>::size_type;
+    using difference_type = typename FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE>::difference_type;
+
+    FixedIndexBasedPoolStorage<T, MAXIMUM_SIZE> storage{};
+
+    [[nodiscard]] constexpr bool full() const noexcept { return storage.full(); }
+    [[nodiscard]] constexpr const T& at(const std::size_t index) const { return storage.at(index); }
+    constexpr T& at(const std::size_t index) { return storage.at(index); }
+    template <class... Args>
+    constexpr std::size_t emplace_and_return_index(Args&&... args)
+    {
+        return storage.emplace_and_return_index(std::forward<Args>(args)...);
+    }
+    constexpr std::size_t delete_at_and_return_repositioned_index(const std::size_t index) noexcept
+    {
+        return storage.delete_at_and_return_repositioned_index(index);
+    }
+};
+static_assert(IsFixedIndexBasedStorage<PerEntryOnlyStorage<int, 5>>);
+static_assert(!IsFixedIndexBasedBulkStorage<PerEntryOnlyStorage<int, 5>>);
+
+// Non-trivial values, so that copies and moves are not defaulted
+using PerEntryOnlyTree = FixedRedBlackTree<int,
+                                           MockNonTrivialInt,
+                                           10,
+                                           std::less<>,
+                                           RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                           PerEntryOnlyStorage>;
+static_assert(!TriviallyCopyable<PerEntryOnlyTree>);
+
 using ES_1 = FixedRedBlackTree<int, int, 10>;
 static_assert(TriviallyCopyable<ES_1>);
 static_assert(NotTrivial<ES_1>);
@@ -221,6 +259,46 @@ std::size_t max_height_of_red_black_tree(const std::size_t size)
     return 2 * static_cast<std::size_t>(std::log2(size + 1));
 }
 
+// Returns the black height of the subtree, or nullopt if it violates a red-black tree property
+// or has inconsistent parent links.
+template <class TreeType>
+std::optional<std::size_t> checked_black_height(const TreeType& tree,
+                                                const NodeIndex& index,
+                                                const NodeIndex& parent_index)
+{
+    if (index == NULL_INDEX)
+    {
+        return 1;
+    }
+    const auto node = tree.node_at(index);
+    if (node.parent_index() != parent_index)
+    {
+        return std::nullopt;
+    }
+    if (node.color() == COLOR_RED && parent_index != NULL_INDEX &&
+        tree.node_at(parent_index).color() == COLOR_RED)
+    {
+        return std::nullopt;
+    }
+    const std::optional<std::size_t> left = checked_black_height(tree, node.left_index(), index);
+    const std::optional<std::size_t> right = checked_black_height(tree, node.right_index(), index);
+    if (!left.has_value() || left != right)
+    {
+        return std::nullopt;
+    }
+    return *left + (node.color() == COLOR_BLACK ? 1 : 0);
+}
+
+template <class TreeType>
+bool is_valid_red_black_tree(const TreeType& tree)
+{
+    if (tree.root_index() != NULL_INDEX && tree.node_at(tree.root_index()).color() != COLOR_BLACK)
+    {
+        return false;
+    }
+    return checked_black_height(tree, tree.root_index(), NULL_INDEX).has_value();
+}
+
 }  // namespace
 
 TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, Basic)
@@ -1872,4 +1950,140 @@ TEST(FixedRedBlackTree, TreeMaxHeight)
         }
     }
 }
+
+TEST(FixedRedBlackTree, Compact)
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    std::array<int, MAXIMUM_SIZE> insertion_order{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        insertion_order[i] = static_cast<int>(i);
+    }
+
+    std::mt19937 rng(7);  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    for (std::size_t remaining = 0; remaining <= MAXIMUM_SIZE; remaining++)
+    {
+        FixedRedBlackTree<int, int, MAXIMUM_SIZE> bst{};
+        std::shuffle(insertion_order.begin(), insertion_order.end(), rng);
+        for (const int key : insertion_order)
+        {
+            bst[key] = key * 10;
+        }
+        for (std::size_t i = remaining; i < MAXIMUM_SIZE; i++)
+        {
+            bst.delete_node(insertion_order[i]);
+        }
+
+        bst.compact();
+        ASSERT_EQ(remaining, bst.size());
+        ASSERT_TRUE(is_valid_red_black_tree(bst));
+        ASSERT_LE(find_height(bst), max_height_of_red_black_tree(bst.size()));
+
+        // In-order traversal visits consecutive indices
+        NodeIndex expected_index = 0;
+        for (NodeIndex i = bst.index_of_min_at(); i != NULL_INDEX;
+             i = bst.index_of_successor_at(i))
+        {
+            ASSERT_EQ(expected_index, i);
+            ASSERT_EQ(bst.node_at(i).key() * 10, bst.node_at(i).value());
+            expected_index++;
+        }
+        ASSERT_EQ(remaining, expected_index);
+
+        // The tree stays usable, and new nodes fill the gap right after the compacted ones
+        if (remaining < MAXIMUM_SIZE)
+        {
+            const int new_key = insertion_order[remaining];
+            bst[new_key] = new_key * 10;
+            ASSERT_EQ(remaining, bst.index_of_node_or_null(new_key));
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+        for (std::size_t i = 0; i < remaining / 2; i++)
+        {
+            bst.delete_node(insertion_order[i]);
+            ASSERT_TRUE(is_valid_red_black_tree(bst));
+        }
+    }
+}
+
+TEST(FixedRedBlackTree, CompactConstexpr)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedRedBlackTree<int, int, 10> bst{};
+        for (int i = 9; i >= 0; i--)
+        {
+            bst[i] = i;
+        }
+        bst.delete_node(0);
+        bst.delete_node(5);
+        bst.compact();
+        return bst;
+    }();
+
+    static_assert(VAL1.size() == 8);
+    static_assert(VAL1.index_of_min_at() == 0);
+    static_assert(VAL1.index_of_max_at() == 7);
+    static_assert(VAL1.node_at(VAL1.index_of_node_or_null(6)).value() == 6);
+}
+
+TEST(FixedRedBlackTree, CompactContiguousStorage)
+{
+    FixedRedBlackTree<int,
+                      int,
+                      10,
+                      std::less<>,
+                      RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                      FixedIndexBasedContiguousStorage>
+        bst{};
+    for (const int key : {5, 3, 8, 1, 4, 9, 2})
+    {
+        bst[key] = key;
+    }
+    bst.delete_node(3);
+    bst.compact();
+    ASSERT_TRUE(is_valid_red_black_tree(bst));
+
+    NodeIndex expected_index = 0;
+    for (NodeIndex i = bst.index_of_min_at(); i != NULL_INDEX; i = bst.index_of_successor_at(i))
+    {
+        EXPECT_EQ(expected_index, i);
+        expected_index++;
+    }
+    EXPECT_EQ(6, expected_index);
+}
+
+TEST(FixedRedBlackTree, PerEntryOnlyStorage)
+{
+    constexpr auto VAL1 = []()
+    {
+        PerEntryOnlyTree bst{};
+        for (const int key : {5, 3, 8, 1})
+        {
+            bst[key].value = key * 10;
+        }
+        PerEntryOnlyTree copy{bst};
+        bst.clear();
+        PerEntryOnlyTree moved{std::move(copy)};
+        return moved;
+    }();
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.node_at(VAL1.index_of_node_or_null(8)).value().value == 80);
+
+    PerEntryOnlyTree bst{};
+    for (const int key : {5, 3, 8, 1, 4, 9, 2})
+    {
+        bst[key] = key;
+    }
+    PerEntryOnlyTree copy{};
+    copy = bst;
+    ASSERT_TRUE(is_valid_red_black_tree(copy));
+    EXPECT_EQ(7, copy.size());
+    bst.clear();
+    EXPECT_EQ(0, bst.size());
+    bst = std::move(copy);
+    ASSERT_TRUE(is_valid_red_black_tree(bst));
+    EXPECT_EQ(7, bst.size());
+}
+
 }  // namespace fixed_containers::fixed_red_black_tree_detail
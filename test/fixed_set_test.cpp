@@ -422,6 +422,29 @@ TEST(FixedSet, Clear)
     static_assert(VAL1.empty());
 }
 
+TEST(FixedSet, Compact)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+        var.erase(1);
+        var.erase(6);
+        var.compact();
+        var.insert(6);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 9);
+    static_assert(std::ranges::equal(VAL1, std::array{0, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    FixedSet<int, 10> var{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    var.erase(3);
+    var.compact();
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 1, 2, 4, 5, 6, 7, 8, 9}));
+    // Entries are laid out in key order
+    EXPECT_TRUE(std::ranges::is_sorted(var, std::less<>{}, [](const int& key) { return &key; }));
+}
+
 TEST(FixedSet, Erase)
 {
     constexpr auto VAL1 = []()
@@ -0,0 +1,215 @@
+#include "fixed_containers/fixed_slot_map.hpp"
+
+#include "instance_counter.hpp"
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace fixed_containers
+{
+namespace
+{
+// Static assert for expected type properties
+namespace trivially_copyable_slot_map
+{
+using SlotMapType = FixedSlotMap<int, 5>;
+static_assert(TriviallyCopyable<SlotMapType>);
+static_assert(NotTrivial<SlotMapType>);
+static_assert(StandardLayout<SlotMapType>);
+static_assert(IsStructuralType<SlotMapType>);
+
+static_assert(std::random_access_iterator<SlotMapType::iterator>);
+static_assert(std::random_access_iterator<SlotMapType::const_iterator>);
+static_assert(std::ranges::random_access_range<SlotMapType>);
+}  // namespace trivially_copyable_slot_map
+
+namespace not_trivially_copyable_slot_map
+{
+using SlotMapType = FixedSlotMap<MockNonTrivialInt, 5>;
+static_assert(!TriviallyCopyable<SlotMapType>);
+static_assert(NotTriviallyDestructible<SlotMapType>);
+}  // namespace not_trivially_copyable_slot_map
+
+}  // namespace
+
+TEST(FixedSlotMap, DefaultConstructor)
+{
+    constexpr FixedSlotMap<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+}
+
+TEST(FixedSlotMap, Insert)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSlotMap<int, 5> var{};
+        const GenerationalIndex h1 = var.insert(10);
+        const GenerationalIndex h2 = var.emplace(20);
+        var.at(h1) += var.at(h2);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(std::ranges::equal(VAL1, std::array{30, 20}));
+
+    FixedSlotMap<int, 5> var{};
+    const GenerationalIndex h1 = var.insert(10);
+    const GenerationalIndex h2 = var.insert(20);
+    EXPECT_EQ(2, var.size());
+    EXPECT_EQ(10, var.at(h1));
+    EXPECT_EQ(20, var[h2]);
+    EXPECT_EQ(h1, var.handle_of(var.cbegin()));
+    EXPECT_EQ(h2, var.handle_of(std::next(var.cbegin())));
+}
+
+TEST(FixedSlotMap, InsertExceedsCapacity)
+{
+    FixedSlotMap<int, 2> var{};
+    var.insert(1);
+    var.insert(2);
+    EXPECT_DEATH(var.insert(3), "");
+    EXPECT_DEATH(var.emplace(3), "");
+}
+
+TEST(FixedSlotMap, EraseKeepsValuesDenseAndHandlesStable)
+{
+    FixedSlotMap<int, 5> var{};
+    const GenerationalIndex h0 = var.insert(0);
+    const GenerationalIndex h1 = var.insert(1);
+    const GenerationalIndex h2 = var.insert(2);
+    const GenerationalIndex h3 = var.insert(3);
+
+    EXPECT_EQ(1, var.erase(h1));
+    EXPECT_EQ(3, var.size());
+    // The last value is moved into the hole
+    EXPECT_TRUE(std::ranges::equal(var, std::array{0, 3, 2}));
+
+    EXPECT_FALSE(var.contains(h1));
+    EXPECT_EQ(0, var.at(h0));
+    EXPECT_EQ(2, var.at(h2));
+    EXPECT_EQ(3, var.at(h3));
+    EXPECT_EQ(h3, var.handle_of(std::next(var.cbegin())));
+
+    // Erasing a stale handle is a no-op
+    EXPECT_EQ(0, var.erase(h1));
+    EXPECT_EQ(3, var.size());
+
+    EXPECT_EQ(1, var.erase(h3));
+    EXPECT_EQ(1, var.erase(h0));
+    EXPECT_TRUE(std::ranges::equal(var, std::array{2}));
+    EXPECT_EQ(2, var.at(h2));
+}
+
+TEST(FixedSlotMap, EraseIterator)
+{
+    FixedSlotMap<int, 5> var{};
+    var.insert(0);
+    const GenerationalIndex h1 = var.insert(1);
+    const GenerationalIndex h2 = var.insert(2);
+
+    auto it = var.erase(var.cbegin());
+    EXPECT_EQ(2, *it);
+    EXPECT_TRUE(std::ranges::equal(var, std::array{2, 1}));
+    EXPECT_EQ(1, var.at(h1));
+    EXPECT_EQ(2, var.at(h2));
+
+    it = var.erase(std::next(var.cbegin()));
+    EXPECT_EQ(var.end(), it);
+    EXPECT_FALSE(var.contains(h1));
+}
+
+TEST(FixedSlotMap, StaleHandleAfterSlotReuse)
+{
+    FixedSlotMap<int, 3> var{};
+    const GenerationalIndex old_handle = var.insert(10);
+    var.erase(old_handle);
+    const GenerationalIndex new_handle = var.insert(20);
+
+    EXPECT_EQ(old_handle.index, new_handle.index);
+    EXPECT_FALSE(var.contains(old_handle));
+    EXPECT_FALSE(var.try_at(old_handle).has_value());
+    EXPECT_EQ(20, var.try_at(new_handle).value());
+    EXPECT_DEATH(var.at(old_handle), "");
+}
+
+TEST(FixedSlotMap, TryAt)
+{
+    FixedSlotMap<int, 3> var{};
+    const GenerationalIndex handle = var.insert(10);
+    *var.try_at(handle) = 11;
+
+    const auto& const_var = var;
+    EXPECT_EQ(11, const_var.try_at(handle).value());
+    EXPECT_FALSE(const_var.try_at(GenerationalIndex{}).has_value());
+}
+
+TEST(FixedSlotMap, Clear)
+{
+    FixedSlotMap<int, 3> var{};
+    const GenerationalIndex h0 = var.insert(10);
+    const GenerationalIndex h1 = var.insert(20);
+    var.clear();
+    EXPECT_TRUE(var.empty());
+    EXPECT_FALSE(var.contains(h0));
+    EXPECT_FALSE(var.contains(h1));
+
+    var.insert(1);
+    var.insert(2);
+    var.insert(3);
+    EXPECT_TRUE(is_full(var));
+}
+
+TEST(FixedSlotMap, EraseIf)
+{
+    FixedSlotMap<int, 8> var{};
+    for (int i = 0; i < 8; i++)
+    {
+        var.insert(i);
+    }
+    const GenerationalIndex h7 = var.handle_of(std::prev(var.cend()));
+
+    EXPECT_EQ(4, erase_if(var, [](const int& entry) { return entry % 2 == 0; }));
+    EXPECT_EQ(4, var.size());
+    EXPECT_TRUE(std::ranges::all_of(var, [](const int& entry) { return entry % 2 == 1; }));
+    EXPECT_EQ(7, var.at(h7));
+}
+
+TEST(FixedSlotMap, Copy)
+{
+    FixedSlotMap<MockNonTrivialInt, 3> var{};
+    const GenerationalIndex handle = var.insert(MockNonTrivialInt{5});
+    const FixedSlotMap<MockNonTrivialInt, 3> copy = var;
+    EXPECT_EQ(5, copy.at(handle).value);
+}
+
+TEST(FixedSlotMap, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedSlotMap<InstanceCounterType, 5> var{};
+        const GenerationalIndex h0 = var.emplace();
+        var.emplace();
+        var.emplace();
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        var.erase(h0);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+        var.clear();
+        EXPECT_EQ(0, InstanceCounterType::counter);
+        var.emplace();
+        EXPECT_EQ(1, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
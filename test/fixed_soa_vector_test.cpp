@@ -0,0 +1,381 @@
+#include "fixed_containers/fixed_soa_vector.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+struct Quote
+{
+    int id;
+    double price;
+    int quantity;
+
+    constexpr bool operator==(const Quote&) const = default;
+};
+
+struct NonTrivialRecord
+{
+    int id;
+    MockNonTrivialCopyConstructible payload;
+};
+
+struct MoveOnlyRecord
+{
+    int id;
+    MockMoveableButNotCopyable payload;
+};
+
+}  // namespace
+
+// Without reflection, the field count is described manually
+template <>
+struct soa_field_count<Quote> : std::integral_constant<std::size_t, 3>
+{
+};
+template <>
+struct soa_field_count<NonTrivialRecord> : std::integral_constant<std::size_t, 2>
+{
+};
+template <>
+struct soa_field_count<MoveOnlyRecord> : std::integral_constant<std::size_t, 2>
+{
+};
+
+namespace
+{
+// Static assert for expected type properties
+namespace trivially_copyable_soa_vector
+{
+using SoAVectorType = FixedSoAVector<Quote, 5>;
+static_assert(TriviallyCopyable<SoAVectorType>);
+static_assert(NotTrivial<SoAVectorType>);
+static_assert(IsStructuralType<SoAVectorType>);
+
+static_assert(std::random_access_iterator<SoAVectorType::iterator>);
+static_assert(std::random_access_iterator<SoAVectorType::const_iterator>);
+static_assert(std::is_same_v<Quote, std::iter_value_t<SoAVectorType::iterator>>);
+static_assert(std::is_same_v<Quote, std::iter_rvalue_reference_t<SoAVectorType::iterator>>);
+static_assert(std::permutable<SoAVectorType::iterator>);
+
+static_assert(std::is_same_v<std::span<double>,
+                             decltype(std::declval<SoAVectorType&>().column<&Quote::price>())>);
+static_assert(
+    std::is_same_v<std::span<const double>,
+                   decltype(std::declval<const SoAVectorType&>().column<&Quote::price>())>);
+}  // namespace trivially_copyable_soa_vector
+
+namespace not_trivially_copyable_soa_vector
+{
+using SoAVectorType = FixedSoAVector<NonTrivialRecord, 5>;
+static_assert(!TriviallyCopyable<SoAVectorType>);
+}  // namespace not_trivially_copyable_soa_vector
+
+}  // namespace
+
+TEST(FixedSoAVector, DefaultConstructor)
+{
+    constexpr FixedSoAVector<Quote, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.max_size() == 8);
+    static_assert(VAL1.column<&Quote::price>().empty());
+}
+
+TEST(FixedSoAVector, InitializerConstructor)
+{
+    constexpr FixedSoAVector<Quote, 8> VAL1{{1, 10.0, 3}, {2, 20.0, 4}};
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1[1].value() == Quote{2, 20.0, 4});
+
+    EXPECT_DEATH((FixedSoAVector<Quote, 1>{{1, 10.0, 3}, {2, 20.0, 4}}), "");
+}
+
+TEST(FixedSoAVector, PushBackAndPopBack)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{};
+        var.push_back({1, 10.5, 100});
+        const Quote quote{2, 11.5, 200};
+        var.push_back(quote);
+        var.push_back({3, 12.5, 300});
+        var.pop_back();
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(std::ranges::equal(VAL1.column<&Quote::id>(), std::array{1, 2}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::price>(), std::array{10.5, 11.5}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::quantity>(), std::array{100, 200}));
+
+    FixedSoAVector<Quote, 2> var{};
+    var.push_back({1, 1.0, 1});
+    var.push_back({2, 2.0, 2});
+    EXPECT_TRUE(is_full(var));
+    EXPECT_DEATH(var.push_back({3, 3.0, 3}), "");
+    var.clear();
+    EXPECT_DEATH(var.pop_back(), "");
+}
+
+TEST(FixedSoAVector, ColumnsAreContiguous)
+{
+    FixedSoAVector<Quote, 8> var{};
+    for (int i = 0; i < 4; i++)
+    {
+        var.push_back({i, static_cast<double>(i) * 2.0, i * 10});
+    }
+
+    const std::span<double> prices = var.column<&Quote::price>();
+    EXPECT_EQ(4, prices.size());
+    EXPECT_EQ(&prices[0] + 3, &prices[3]);
+
+    // Writes through the span are visible through the element API
+    for (double& price : prices)
+    {
+        price += 1.0;
+    }
+    EXPECT_EQ(7.0, var[3].get<&Quote::price>());
+    EXPECT_EQ((Quote{3, 7.0, 30}), var.back().value());
+}
+
+TEST(FixedSoAVector, ReferenceProxy)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{};
+        var.push_back({1, 10.0, 100});
+        var.push_back({2, 20.0, 200});
+        var[0].get<&Quote::quantity>() = 101;
+        var[1] = Quote{5, 50.0, 500};
+        var.front() = var.back();
+        return var;
+    }();
+
+    static_assert(VAL1[0].value() == Quote{5, 50.0, 500});
+    static_assert(VAL1.at(1).get<&Quote::id>() == 5);
+
+    FixedSoAVector<Quote, 8> var{};
+    var.push_back({1, 10.0, 100});
+    const Quote materialized = var[0];
+    EXPECT_EQ((Quote{1, 10.0, 100}), materialized);
+    EXPECT_DEATH((void)var.at(1), "");
+    EXPECT_DEATH((void)var[1], "");
+}
+
+TEST(FixedSoAVector, Iteration)
+{
+    constexpr FixedSoAVector<Quote, 8> VAL1{{1, 1.0, 10}, {2, 2.0, 20}, {3, 3.0, 30}};
+
+    static_assert(std::distance(VAL1.begin(), VAL1.end()) == 3);
+    static_assert((*std::next(VAL1.begin(), 2)).get<&Quote::id>() == 3);
+    static_assert((*VAL1.rbegin()).get<&Quote::id>() == 3);
+
+    FixedSoAVector<Quote, 8> var = VAL1;
+    int sum = 0;
+    for (auto quote : var)
+    {
+        quote.get<&Quote::quantity>() += 1;
+        sum += quote.get<&Quote::id>();
+    }
+    EXPECT_EQ(6, sum);
+    EXPECT_TRUE(std::ranges::equal(var.column<&Quote::quantity>(), std::array{11, 21, 31}));
+}
+
+TEST(FixedSoAVector, RangesAlgorithms)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{3, 3.0, 30}, {1, 1.0, 10}, {4, 4.0, 40}, {2, 2.0, 20}};
+        std::ranges::sort(var, {}, [](const Quote& quote) { return quote.price; });
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1.column<&Quote::id>(), std::array{1, 2, 3, 4}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::price>(), std::array{1.0, 2.0, 3.0, 4.0}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::quantity>(), std::array{10, 20, 30, 40}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{1, 1.0, 10}, {2, 2.0, 20}, {3, 3.0, 30}};
+        std::ranges::reverse(var);
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL2.column<&Quote::id>(), std::array{3, 2, 1}));
+    static_assert(std::ranges::equal(VAL2.column<&Quote::quantity>(), std::array{30, 20, 10}));
+
+    FixedSoAVector<Quote, 8> var{{5, 5.0, 50}, {1, 1.0, 10}, {3, 3.0, 30}, {2, 2.0, 20}};
+    std::ranges::sort(var, std::ranges::greater{}, [](const Quote& quote) { return quote.id; });
+    EXPECT_TRUE(std::ranges::equal(var.column<&Quote::id>(), std::array{5, 3, 2, 1}));
+    EXPECT_TRUE(std::ranges::equal(var.column<&Quote::price>(), std::array{5.0, 3.0, 2.0, 1.0}));
+
+    std::ranges::iter_swap(var.begin(), std::next(var.begin()));
+    EXPECT_EQ((Quote{3, 3.0, 30}), var[0].value());
+    EXPECT_EQ((Quote{5, 5.0, 50}), var[1].value());
+
+    using std::swap;
+    swap(*var.begin(), *std::prev(var.end()));
+    EXPECT_EQ((Quote{1, 1.0, 10}), var[0].value());
+    EXPECT_EQ((Quote{3, 3.0, 30}), var[3].value());
+
+    const Quote moved_out = std::ranges::iter_move(std::next(var.begin()));
+    EXPECT_EQ((Quote{5, 5.0, 50}), moved_out);
+}
+
+TEST(FixedSoAVector, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{0, 0.0, 0}, {1, 1.0, 1}, {2, 2.0, 2}, {3, 3.0, 3}};
+        var.erase(std::next(var.cbegin()));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1.column<&Quote::id>(), std::array{0, 2, 3}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::price>(), std::array{0.0, 2.0, 3.0}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{0, 0.0, 0}, {1, 1.0, 1}, {2, 2.0, 2}, {3, 3.0, 3}};
+        var.erase(std::next(var.cbegin()), std::next(var.cbegin(), 3));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL2.column<&Quote::id>(), std::array{0, 3}));
+
+    FixedSoAVector<Quote, 8> var{{0, 0.0, 0}};
+    EXPECT_DEATH(var.erase(var.cend()), "");
+}
+
+TEST(FixedSoAVector, EraseUnordered)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{0, 0.0, 0}, {1, 1.0, 1}, {2, 2.0, 2}, {3, 3.0, 3}};
+        var.erase_unordered(var.cbegin());
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1.column<&Quote::id>(), std::array{3, 1, 2}));
+    static_assert(std::ranges::equal(VAL1.column<&Quote::quantity>(), std::array{3, 1, 2}));
+}
+
+TEST(FixedSoAVector, EraseIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{
+            {0, 0.0, 0}, {1, 1.0, 1}, {2, 2.0, 2}, {3, 3.0, 3}, {4, 4.0, 4}};
+        const std::size_t removed_count =
+            erase_if(var, [](const Quote& quote) { return quote.id % 2 == 1; });
+        return std::pair{var, removed_count};
+    }();
+    static_assert(VAL1.second == 2);
+    static_assert(std::ranges::equal(VAL1.first.column<&Quote::id>(), std::array{0, 2, 4}));
+    static_assert(
+        std::ranges::equal(VAL1.first.column<&Quote::price>(), std::array{0.0, 2.0, 4.0}));
+}
+
+TEST(FixedSoAVector, EraseIfMoveOnlyField)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<MoveOnlyRecord, 8> var{};
+        for (int i = 0; i < 5; i++)
+        {
+            var.push_back({i, {}});
+        }
+        const std::size_t removed_count = erase_if(
+            var, [](const auto& record) { return record.template get<&MoveOnlyRecord::id>() < 2; });
+        return std::pair{var.column<&MoveOnlyRecord::id>()[0], removed_count};
+    }();
+    static_assert(VAL1.first == 2);
+    static_assert(VAL1.second == 2);
+
+    FixedSoAVector<MoveOnlyRecord, 8> var{};
+    var.push_back({0, {}});
+    var.push_back({1, {}});
+    var.push_back({2, {}});
+    EXPECT_EQ(1,
+              erase_if(var,
+                       [](const auto& record)
+                       { return record.template get<&MoveOnlyRecord::id>() == 0; }));
+    EXPECT_TRUE(std::ranges::equal(var.column<&MoveOnlyRecord::id>(), std::array{1, 2}));
+}
+
+TEST(FixedSoAVector, Resize)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<Quote, 8> var{{1, 1.0, 1}, {2, 2.0, 2}};
+        var.resize(4);
+        var.resize(3);
+        return var;
+    }();
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1[2].value() == Quote{0, 0.0, 0});
+
+    FixedSoAVector<Quote, 2> var{};
+    EXPECT_DEATH(var.resize(3), "");
+}
+
+TEST(FixedSoAVector, Equality)
+{
+    constexpr FixedSoAVector<Quote, 8> VAL1{{1, 1.0, 1}, {2, 2.0, 2}};
+    constexpr FixedSoAVector<Quote, 4> VAL2{{1, 1.0, 1}, {2, 2.0, 2}};
+    constexpr FixedSoAVector<Quote, 8> VAL3{{1, 1.0, 1}, {2, 2.5, 2}};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+}
+
+TEST(FixedSoAVector, NonTrivialFields)
+{
+    FixedSoAVector<NonTrivialRecord, 4> var{};
+    var.push_back({1, {}});
+    const NonTrivialRecord record{2, {}};
+    var.push_back(record);
+    var.push_back({3, {}});
+    var.erase(var.cbegin());
+
+    const FixedSoAVector<NonTrivialRecord, 4> copy = var;
+    EXPECT_EQ(2, copy.size());
+    EXPECT_TRUE(std::ranges::equal(copy.column<&NonTrivialRecord::id>(), std::array{2, 3}));
+}
+
+#if defined(__clang__) && __clang_major__ >= 15
+namespace
+{
+struct ReflectedQuote
+{
+    int id;
+    double price;
+};
+}  // namespace
+
+TEST(FixedSoAVector, FieldCountFromReflection)
+{
+    static_assert(soa_field_count_v<ReflectedQuote> == 2);
+
+    constexpr auto VAL1 = []()
+    {
+        FixedSoAVector<ReflectedQuote, 8> var{};
+        var.push_back({1, 10.5});
+        var.push_back({2, 11.5});
+        return var;
+    }();
+    static_assert(
+        std::ranges::equal(VAL1.column<&ReflectedQuote::price>(), std::array{10.5, 11.5}));
+}
+#endif
+
+}  // namespace fixed_containers
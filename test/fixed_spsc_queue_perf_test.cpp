@@ -0,0 +1,228 @@
+#include "fixed_containers/fixed_circular_queue.hpp"
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 4096;
+constexpr std::size_t MAX_BATCH_SIZE = 64;
+constexpr std::size_t MESSAGES_PER_ITERATION = 1024;
+
+using Message = std::array<std::uint64_t, 4>;
+
+// The baseline: a FixedCircularQueue shared by both threads behind a mutex
+class MutexGuardedCircularQueue
+{
+    std::mutex mutex_{};
+    FixedCircularQueue<Message, CAP> queue_{};
+
+public:
+    bool try_push(const Message& value)
+    {
+        const std::scoped_lock lock{mutex_};
+        if (is_full(queue_))
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+    std::size_t try_push_n(const std::span<const Message> values)
+    {
+        const std::scoped_lock lock{mutex_};
+        const std::size_t count = (std::min)(values.size(), CAP - queue_.size());
+        queue_.push_n(values.first(count));
+        return count;
+    }
+    bool try_pop(Message& out)
+    {
+        const std::scoped_lock lock{mutex_};
+        if (queue_.empty())
+        {
+            return false;
+        }
+        out = queue_.front();
+        queue_.pop();
+        return true;
+    }
+    std::size_t try_pop_n(const std::span<Message> out)
+    {
+        const std::scoped_lock lock{mutex_};
+        return queue_.pop_n(out);
+    }
+};
+
+template <typename QueueType>
+void push_all(QueueType& queue, const std::span<const Message> values)
+{
+    if (values.size() == 1)
+    {
+        while (!queue.try_push(values.front()))
+        {
+        }
+        return;
+    }
+    for (std::size_t pushed_count = 0; pushed_count < values.size();)
+    {
+        pushed_count += queue.try_push_n(values.subspan(pushed_count));
+    }
+}
+
+template <typename QueueType>
+std::size_t pop_some(QueueType& queue, const std::span<Message> out)
+{
+    if (out.size() == 1)
+    {
+        return queue.try_pop(out.front()) ? 1 : 0;
+    }
+    return queue.try_pop_n(out);
+}
+
+// The cost of the queue operations alone: both sides run on the calling thread, so there is no
+// contention and no cache line transfer
+template <typename QueueType>
+void benchmark_uncontended(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    const auto queue = std::make_unique<QueueType>();
+    std::array<Message, MAX_BATCH_SIZE> batch{};
+    std::array<Message, MAX_BATCH_SIZE> out{};
+    for (auto _ : state)
+    {
+        for (std::size_t sent_count = 0; sent_count < MESSAGES_PER_ITERATION;
+             sent_count += batch_size)
+        {
+            batch[0][0] = sent_count;
+            push_all(*queue, std::span<const Message>{batch.data(), batch_size});
+            const std::size_t count = pop_some(*queue, std::span<Message>{out.data(), batch_size});
+            benchmark::DoNotOptimize(count);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(MESSAGES_PER_ITERATION));
+}
+
+BENCHMARK(benchmark_uncontended<MutexGuardedCircularQueue>)
+    ->RangeMultiplier(8)
+    ->Range(1, MAX_BATCH_SIZE);
+BENCHMARK(benchmark_uncontended<FixedSpscQueue<Message, CAP>>)
+    ->RangeMultiplier(8)
+    ->Range(1, MAX_BATCH_SIZE);
+
+// Messages per second from one producer thread to one consumer thread, in batches of
+// `state.range(0)` messages (1 uses the single-element functions)
+template <typename QueueType>
+void benchmark_throughput(benchmark::State& state)
+{
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    const auto queue = std::make_unique<QueueType>();
+    std::atomic<bool> done{false};
+
+    std::thread consumer{[&queue, &done, batch_size]()
+                         {
+                             std::array<Message, MAX_BATCH_SIZE> out{};
+                             const std::span<Message> out_span{out.data(), batch_size};
+                             std::uint64_t checksum = 0;
+                             while (true)
+                             {
+                                 // Read the flag first, so that nothing pushed before it was set
+                                 // gets left behind
+                                 const bool producer_done = done.load(std::memory_order_acquire);
+                                 const std::size_t count = pop_some(*queue, out_span);
+                                 for (std::size_t i = 0; i < count; i++)
+                                 {
+                                     checksum += out[i][0];
+                                 }
+                                 if (producer_done && count == 0)
+                                 {
+                                     break;
+                                 }
+                             }
+                             benchmark::DoNotOptimize(checksum);
+                         }};
+
+    std::array<Message, MAX_BATCH_SIZE> batch{};
+    std::uint64_t sequence_number = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t sent_count = 0; sent_count < MESSAGES_PER_ITERATION;
+             sent_count += batch_size)
+        {
+            for (std::size_t i = 0; i < batch_size; i++)
+            {
+                batch[i][0] = sequence_number++;
+            }
+            push_all(*queue, std::span<const Message>{batch.data(), batch_size});
+        }
+    }
+
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(MESSAGES_PER_ITERATION));
+}
+
+BENCHMARK(benchmark_throughput<MutexGuardedCircularQueue>)
+    ->RangeMultiplier(8)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->UseRealTime();
+BENCHMARK(benchmark_throughput<FixedSpscQueue<Message, CAP>>)
+    ->RangeMultiplier(8)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->UseRealTime();
+
+// Round trip of one message to an echo thread and back, through two queues
+template <typename QueueType>
+void benchmark_round_trip_latency(benchmark::State& state)
+{
+    const auto requests = std::make_unique<QueueType>();
+    const auto responses = std::make_unique<QueueType>();
+    std::atomic<bool> done{false};
+
+    std::thread echo{[&requests, &responses, &done]()
+                     {
+                         Message message{};
+                         while (!done.load(std::memory_order_relaxed))
+                         {
+                             if (requests->try_pop(message))
+                             {
+                                 push_all(*responses, std::span<const Message>{&message, 1});
+                             }
+                         }
+                     }};
+
+    Message message{};
+    for (auto _ : state)
+    {
+        message[0]++;
+        push_all(*requests, std::span<const Message>{&message, 1});
+        while (!responses->try_pop(message))
+        {
+        }
+    }
+
+    done.store(true, std::memory_order_relaxed);
+    echo.join();
+}
+
+BENCHMARK(benchmark_round_trip_latency<MutexGuardedCircularQueue>)->UseRealTime();
+BENCHMARK(benchmark_round_trip_latency<FixedSpscQueue<Message, CAP>>)->UseRealTime();
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,220 @@
+#include "fixed_containers/fixed_spsc_queue.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/memory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using SpscQueueType = FixedSpscQueue<int, 8>;
+static_assert(StandardLayout<SpscQueueType>);
+static_assert(TriviallyDestructible<SpscQueueType>);
+static_assert(NotCopyConstructible<SpscQueueType>);
+static_assert(NotMoveConstructible<SpscQueueType>);
+static_assert(alignof(SpscQueueType) == memory::CACHE_LINE_SIZE);
+
+// The producer and consumer counters must not share a cache line
+static_assert(offsetof(SpscQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_) -
+                  offsetof(SpscQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_head_) >=
+              memory::CACHE_LINE_SIZE);
+static_assert(offsetof(SpscQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_array_) -
+                  offsetof(SpscQueueType, IMPLEMENTATION_DETAIL_DO_NOT_USE_tail_) >=
+              memory::CACHE_LINE_SIZE);
+}  // namespace
+
+TEST(FixedSpscQueue, DefaultConstructor)
+{
+    const FixedSpscQueue<int, 8> var1{};
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.size());
+    EXPECT_EQ(8, var1.max_size());
+    static_assert(FixedSpscQueue<int, 8>::static_max_size() == 8);
+}
+
+TEST(FixedSpscQueue, PushAndPop)
+{
+    FixedSpscQueue<int, 4> var1{};
+    EXPECT_TRUE(var1.try_push(1));
+    const int value = 2;
+    EXPECT_TRUE(var1.try_push(value));
+    EXPECT_TRUE(var1.try_emplace(3));
+    EXPECT_EQ(3, var1.size());
+
+    int out = 0;
+    EXPECT_TRUE(var1.try_pop(out));
+    EXPECT_EQ(1, out);
+    EXPECT_TRUE(var1.try_pop(out));
+    EXPECT_EQ(2, out);
+    EXPECT_TRUE(var1.try_pop(out));
+    EXPECT_EQ(3, out);
+    EXPECT_FALSE(var1.try_pop(out));
+    EXPECT_EQ(3, out);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedSpscQueue, Full)
+{
+    FixedSpscQueue<int, 4> var1{};
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(var1.try_push(i));
+    }
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_FALSE(var1.try_push(4));
+
+    // Wrap around the end of the storage
+    int out = 0;
+    EXPECT_TRUE(var1.try_pop(out));
+    EXPECT_TRUE(var1.try_push(4));
+    for (int i = 1; i <= 4; i++)
+    {
+        EXPECT_TRUE(var1.try_pop(out));
+        EXPECT_EQ(i, out);
+    }
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedSpscQueue, PushNAndPopN)
+{
+    FixedSpscQueue<int, 8> var1{};
+    EXPECT_EQ(6, var1.try_push_n(std::array{0, 1, 2, 3, 4, 5}));
+    std::array<int, 4> out1{};
+    EXPECT_EQ(4, var1.try_pop_n(out1));
+    EXPECT_EQ((std::array{0, 1, 2, 3}), out1);
+
+    // Only as many as fit are pushed, and both calls go across the end of the storage
+    EXPECT_EQ(6, var1.try_push_n(std::array{6, 7, 8, 9, 10, 11, 12, 13}));
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_EQ(0, var1.try_push_n(std::array{14}));
+
+    std::array<int, 10> out2{};
+    EXPECT_EQ(8, var1.try_pop_n(out2));
+    EXPECT_EQ((std::array{4, 5, 6, 7, 8, 9, 10, 11, 0, 0}), out2);
+    EXPECT_EQ(0, var1.try_pop_n(out2));
+}
+
+TEST(FixedSpscQueue, Consume)
+{
+    FixedSpscQueue<int, 8> var1{};
+    var1.try_push_n(std::array{0, 1, 2, 3, 4, 5});
+    int out = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        var1.try_pop(out);
+    }
+    var1.try_push_n(std::array{6, 7, 8, 9});  // {5, 6, 7, 8, 9}, wrapping after 7
+
+    std::vector<std::size_t> segment_sizes{};
+    int sum = 0;
+    const std::size_t consumed_count = var1.consume(4,
+                                                    [&](const std::span<int> segment)
+                                                    {
+                                                        segment_sizes.push_back(segment.size());
+                                                        for (const int entry : segment)
+                                                        {
+                                                            sum += entry;
+                                                        }
+                                                    });
+    EXPECT_EQ(4, consumed_count);
+    EXPECT_EQ(26, sum);
+    EXPECT_EQ((std::vector<std::size_t>{3, 1}), segment_sizes);
+    EXPECT_EQ(1, var1.size());
+    EXPECT_EQ(1, var1.consume(8, [](const std::span<int> /*segment*/) {}));
+    EXPECT_EQ(0, var1.consume(8, [](const std::span<int> /*segment*/) { FAIL(); }));
+}
+
+TEST(FixedSpscQueue, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedSpscQueue<InstanceCounterType, 4> var1{};
+        var1.try_emplace(1);
+        var1.try_push_n(std::array<InstanceCounterType, 2>{2, 3});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+
+        InstanceCounterType out{};
+        var1.try_pop(out);
+        EXPECT_EQ(1, out.get());
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        var1.consume(1, [](const std::span<InstanceCounterType> /*segment*/) {});
+        EXPECT_EQ(2, InstanceCounterType::counter);
+    }
+    // The remaining element is destroyed along with the queue
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedSpscQueue, ProducerAndConsumerThreads)
+{
+    static constexpr int MESSAGE_COUNT = 100'000;
+    FixedSpscQueue<int, 64> var1{};
+
+    std::thread producer{[&var1]()
+                         {
+                             std::array<int, 5> batch{};
+                             int next = 0;
+                             while (next < MESSAGE_COUNT)
+                             {
+                                 // Alternate between single and batched pushes, and give up the
+                                 // time slice while the queue is full
+                                 std::size_t pushed_count = 0;
+                                 if (next % 2 == 0)
+                                 {
+                                     pushed_count = var1.try_push(next) ? 1U : 0U;
+                                 }
+                                 else
+                                 {
+                                     for (std::size_t i = 0; i < batch.size(); i++)
+                                     {
+                                         batch[i] = next + static_cast<int>(i);
+                                     }
+                                     const std::size_t count =
+                                         (std::min)(batch.size(),
+                                                    static_cast<std::size_t>(MESSAGE_COUNT - next));
+                                     pushed_count =
+                                         var1.try_push_n(std::span<const int>{batch.data(), count});
+                                 }
+                                 if (pushed_count == 0)
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                                 next += static_cast<int>(pushed_count);
+                             }
+                         }};
+
+    int expected = 0;
+    bool in_order = true;
+    std::array<int, 7> out{};
+    while (expected < MESSAGE_COUNT)
+    {
+        const std::size_t count = var1.try_pop_n(out);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            in_order = in_order && out.at(i) == expected;
+            expected++;
+        }
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(MESSAGE_COUNT, expected);
+    EXPECT_TRUE(var1.empty());
+}
+
+}  // namespace fixed_containers
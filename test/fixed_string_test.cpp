@@ -11,7 +11,9 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
+#include <ranges>
 #include <span>
 #include <sstream>
 #include <string>
@@ -31,6 +33,11 @@ static_assert(IsStructuralType<FixedStringType>);
 static_assert(std::contiguous_iterator<FixedStringType::iterator>);
 static_assert(std::contiguous_iterator<FixedStringType::const_iterator>);
 
+// The size is stored in the narrowest integer that can hold the capacity
+static_assert(consteval_compare::equal<16, sizeof(FixedString<14>)>);
+static_assert(consteval_compare::equal<17, sizeof(FixedString<15>)>);
+static_assert(consteval_compare::equal<260, sizeof(FixedString<256>)>);
+
 void const_span_ref(const std::span<char>& /*unused*/) {}
 void const_span_of_const_ref(const std::span<const char>& /*unused*/) {}
 
@@ -932,6 +939,27 @@ TEST(FixedString, InsertStringView)
     }
 }
 
+TEST(FixedString, InsertRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<7> var{"05"};
+        var.insert_range(std::next(var.cbegin()), std::string_view{"12"});
+        var.insert_range(std::next(var.cbegin(), 3), std::views::iota('3', '5'));
+        return var;
+    }();
+    static_assert(VAL1 == "012345");
+    static_assert(*VAL1.end() == '\0');
+
+    FixedString<7> var1{"0"};
+    auto iter = var1.insert_range(var1.cbegin(), std::array{'a', 'b'});
+    EXPECT_EQ("ab0", var1);
+    EXPECT_EQ(iter, var1.begin());
+    EXPECT_EQ('\0', *var1.end());
+
+    EXPECT_DEATH(var1.insert_range(var1.cbegin(), std::string_view{"12345"}), "");
+}
+
 TEST(FixedString, EraseRange)
 {
     constexpr auto VAL1 = []()
@@ -1014,6 +1042,36 @@ TEST(FixedString, EraseEmpty)
     }
 }
 
+TEST(FixedString, EraseFreeFunction)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<8> var{"abcabca"};
+        const std::size_t removed_count = fixed_containers::erase(var, 'a');
+        assert_or_abort(3 == removed_count);
+        return var;
+    }();
+
+    static_assert(VAL1 == "bcbc");
+    static_assert(VAL1.size() == 4);
+}
+
+TEST(FixedString, EraseIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<8> var{"a1b2c3"};
+        const std::size_t removed_count =
+            fixed_containers::erase_if(var, [](const char& entry) { return entry < 'a'; });
+        assert_or_abort(3 == removed_count);
+        return var;
+    }();
+
+    static_assert(VAL1 == "abc");
+    // Null-termination is maintained
+    static_assert(*std::next(VAL1.data(), 3) == '\0');
+}
+
 TEST(FixedString, PushBack)
 {
     constexpr auto VAL1 = []()
@@ -1498,6 +1556,66 @@ TEST(FixedString, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+TEST(FixedString, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<7> var{"012"};
+        var.resize_for_overwrite(5);
+        return var;
+    }();
+    static_assert(VAL1.size() == 5);
+    static_assert(VAL1[3] == '\0');
+    static_assert(*VAL1.end() == '\0');
+
+    FixedString<7> var1{"012"};
+    var1.resize_for_overwrite(6);
+    std::memcpy(std::next(var1.data(), 3), "345", 3);
+    EXPECT_EQ("012345", var1);
+    EXPECT_EQ('\0', *var1.end());
+
+    var1.resize_for_overwrite(2);
+    EXPECT_EQ("01", var1);
+    EXPECT_EQ('\0', *var1.end());
+
+    EXPECT_DEATH(var1.resize_for_overwrite(8), "");
+}
+
+TEST(FixedString, AppendUninitialized)
+{
+    FixedString<7> var1{"01"};
+    char* const appended = var1.append_uninitialized(3);
+    EXPECT_EQ(std::next(var1.data(), 2), appended);
+    EXPECT_EQ(5, var1.size());
+    EXPECT_EQ('\0', *var1.end());
+    std::memcpy(appended, "234", 3);
+    EXPECT_EQ("01234", var1);
+    EXPECT_EQ('\0', *var1.end());
+
+    EXPECT_DEATH(var1.append_uninitialized(3), "");
+}
+
+TEST(FixedString, AppendRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedString<7> var{"01"};
+        var.append_range(std::string_view{"23"});
+        var.append_range(std::array{'4'});
+        return var;
+    }();
+    static_assert(VAL1 == "01234");
+    static_assert(*VAL1.end() == '\0');
+
+    FixedString<7> var1{"0"};
+    var1.append_range(std::string_view{"12"});
+    var1.append_range(std::views::iota('3', '5'));
+    EXPECT_EQ("01234", var1);
+    EXPECT_EQ('\0', *var1.end());
+
+    EXPECT_DEATH(var1.append_range(std::string_view{"567"}), "");
+}
+
 TEST(FixedString, Full)
 {
     constexpr auto VAL1 = []()
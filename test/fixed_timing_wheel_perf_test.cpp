@@ -0,0 +1,101 @@
+#include "fixed_containers/fixed_indexed_priority_queue.hpp"
+#include "fixed_containers/fixed_timing_wheel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 65536;
+constexpr std::uint64_t MAX_TIMEOUT = 5000;
+
+struct Order
+{
+    std::uint64_t id;
+};
+
+// What a timing wheel is usually replaced with: a min-queue of deadlines
+class HeapTimers
+{
+    struct Timer
+    {
+        std::uint64_t deadline;
+        Order order;
+        constexpr bool operator>(const Timer& other) const { return deadline > other.deadline; }
+    };
+
+    FixedIndexedPriorityQueue<Timer, CAP, std::greater<Timer>> queue_{};
+    std::uint64_t now_{0};
+
+public:
+    GenerationalIndex schedule(const std::uint64_t deadline, const Order& order)
+    {
+        return queue_.push({deadline, order});
+    }
+    void cancel(const GenerationalIndex& handle) { queue_.erase(handle); }
+    template <class Func>
+    std::size_t for_each_expired(const std::uint64_t now, Func&& func)
+    {
+        std::size_t fired_count = 0;
+        while (!queue_.empty() && queue_.top().deadline <= now)
+        {
+            func(queue_.top().order);
+            queue_.pop();
+            fired_count++;
+        }
+        now_ = now;
+        return fired_count;
+    }
+    [[nodiscard]] std::uint64_t now() const { return now_; }
+};
+
+using WheelTimers = FixedTimingWheel<Order, CAP>;
+
+// Order timeouts at a steady state of about `state.range(0)` pending timers: every tick, new
+// orders arrive with a random timeout, and most orders are filled (their timer is cancelled)
+// before they time out
+template <typename TimersType>
+void benchmark_order_timeouts(benchmark::State& state)
+{
+    const auto pending_count = static_cast<std::size_t>(state.range(0));
+    const auto timers = std::make_unique<TimersType>();
+    const auto handles = std::make_unique<std::array<GenerationalIndex, CAP>>();
+    std::mt19937_64 generator{42};
+    std::uint64_t next_id = 0;
+    std::uint64_t checksum = 0;
+    const auto on_timeout = [&checksum](const Order& order) { checksum += order.id; };
+
+    // Every tick, as many orders arrive as are cancelled or time out on average
+    constexpr std::size_t ARRIVALS_PER_TICK = 16;
+    for (auto _ : state)
+    {
+        const std::uint64_t now = timers->now() + 1;
+        for (std::size_t i = 0; i < ARRIVALS_PER_TICK; i++)
+        {
+            // Cancel a random earlier order, which may have already been cancelled or fired
+            const std::size_t slot = generator() % pending_count;
+            timers->cancel((*handles)[slot]);
+            const std::uint64_t deadline = now + 1 + (generator() % MAX_TIMEOUT);
+            (*handles)[slot] = timers->schedule(deadline, Order{next_id++});
+        }
+        benchmark::DoNotOptimize(timers->for_each_expired(now, on_timeout));
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ARRIVALS_PER_TICK));
+}
+
+BENCHMARK(benchmark_order_timeouts<HeapTimers>)->RangeMultiplier(8)->Range(512, CAP);
+BENCHMARK(benchmark_order_timeouts<WheelTimers>)->RangeMultiplier(8)->Range(512, CAP);
+
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -0,0 +1,329 @@
+#include "fixed_containers/fixed_timing_wheel.hpp"
+
+#include "instance_counter.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/max_size.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using TimingWheelType = FixedTimingWheel<int, 5>;
+static_assert(TriviallyCopyable<TimingWheelType>);
+static_assert(NotTrivial<TimingWheelType>);
+static_assert(StandardLayout<TimingWheelType>);
+static_assert(ConstexprDefaultConstructible<TimingWheelType>);
+
+// 3 levels of 4 slots: spans 64 ticks, with slots of 1, 4 and 16 ticks
+using SmallTimingWheel = FixedTimingWheel<int, 32, 3, 4>;
+
+// Advances to `now`, and returns the payloads that fired
+template <typename TimingWheelType>
+std::vector<int> advance(TimingWheelType& wheel, const std::uint64_t now)
+{
+    std::vector<int> fired{};
+    const std::size_t fired_count =
+        wheel.for_each_expired(now, [&fired](const int payload) { fired.push_back(payload); });
+    EXPECT_EQ(fired.size(), fired_count);
+    EXPECT_EQ(now, wheel.now());
+    return fired;
+}
+}  // namespace
+
+TEST(FixedTimingWheel, DefaultConstructor)
+{
+    constexpr FixedTimingWheel<int, 8> VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.now() == 0);
+    static_assert(VAL1.max_size() == 8);
+    static_assert(max_size_v<FixedTimingWheel<int, 8>> == 8);
+
+    constexpr FixedTimingWheel<int, 8> VAL2{1000};
+    static_assert(VAL2.now() == 1000);
+}
+
+TEST(FixedTimingWheel, FiresAtDeadline)
+{
+    constexpr std::size_t FIRED_COUNT = []()
+    {
+        FixedTimingWheel<int, 8> var{};
+        var.schedule(3, 30);
+        var.schedule(5, 50);
+        return var.for_each_expired(4, [](const int /*payload*/) {});
+    }();
+    static_assert(FIRED_COUNT == 1);
+
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle = var1.schedule(3, 30);
+    var1.schedule(3, 31);
+    var1.schedule(1, 10);
+    EXPECT_EQ(3, var1.size());
+    EXPECT_EQ(3, var1.deadline_of(handle));
+    EXPECT_EQ(30, var1.at(handle));
+
+    EXPECT_EQ((std::vector<int>{10}), advance(var1, 2));
+    EXPECT_TRUE(var1.contains(handle));
+    std::vector<int> fired = advance(var1, 3);
+    std::ranges::sort(fired);
+    EXPECT_EQ((std::vector<int>{30, 31}), fired);
+    EXPECT_FALSE(var1.contains(handle));
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedTimingWheel, AcrossLevels)
+{
+    SmallTimingWheel var1{};
+    // Levels 0, 1 and 2, and beyond the span of the wheel
+    for (const int deadline : {2, 7, 21, 40, 63, 64, 100, 1000})
+    {
+        var1.schedule(static_cast<std::uint64_t>(deadline), deadline);
+    }
+
+    std::vector<int> fired{};
+    for (std::uint64_t tick = 1; tick <= 1000; tick++)
+    {
+        for (const int payload : advance(var1, tick))
+        {
+            // Each one fires exactly at its deadline
+            EXPECT_EQ(tick, static_cast<std::uint64_t>(payload));
+            fired.push_back(payload);
+        }
+    }
+    EXPECT_EQ((std::vector<int>{2, 7, 21, 40, 63, 64, 100, 1000}), fired);
+}
+
+TEST(FixedTimingWheel, AdvanceByManyTicks)
+{
+    SmallTimingWheel var1{10};
+    var1.schedule(12, 12);
+    var1.schedule(50, 50);
+    var1.schedule(500, 500);
+    EXPECT_EQ((std::vector<int>{12, 50}), advance(var1, 400));
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 499));
+    EXPECT_EQ((std::vector<int>{500}), advance(var1, 1000));
+
+    // Nothing to process, jumps straight to `now`
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 1'000'000'000));
+    var1.schedule(1'000'000'005, 5);
+    EXPECT_EQ((std::vector<int>{5}), advance(var1, 1'000'000'005));
+}
+
+TEST(FixedTimingWheel, PastDeadlineFiresOnNextTick)
+{
+    SmallTimingWheel var1{10};
+    var1.schedule(3, 3);
+    var1.schedule(10, 10);
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 10));
+    std::vector<int> fired = advance(var1, 11);
+    std::ranges::sort(fired);
+    EXPECT_EQ((std::vector<int>{3, 10}), fired);
+}
+
+TEST(FixedTimingWheel, Cancel)
+{
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle1 = var1.schedule(5, 1);
+    const GenerationalIndex handle2 = var1.schedule(40, 2);
+    const GenerationalIndex handle3 = var1.schedule(40, 3);
+    EXPECT_EQ(1, var1.cancel(handle1));
+    EXPECT_EQ(0, var1.cancel(handle1));
+    EXPECT_EQ(1, var1.cancel(handle3));
+    EXPECT_EQ(1, var1.size());
+
+    EXPECT_EQ((std::vector<int>{2}), advance(var1, 40));
+    EXPECT_EQ(0, var1.cancel(handle2));
+    EXPECT_FALSE(var1.contains(GenerationalIndex{}));
+    EXPECT_DEATH((void)var1.at(handle2), "");
+}
+
+TEST(FixedTimingWheel, StaleHandleAfterNodeReuse)
+{
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle1 = var1.schedule(5, 1);
+    var1.cancel(handle1);
+    const GenerationalIndex handle2 = var1.schedule(5, 2);
+    EXPECT_EQ(handle1.index, handle2.index);
+    EXPECT_FALSE(var1.contains(handle1));
+    EXPECT_EQ(0, var1.cancel(handle1));
+    EXPECT_DEATH(var1.reschedule(handle1, 7), "");
+    EXPECT_EQ(2, var1.at(handle2));
+}
+
+TEST(FixedTimingWheel, Reschedule)
+{
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle1 = var1.schedule(5, 1);
+    const GenerationalIndex handle2 = var1.schedule(50, 2);
+    var1.reschedule(handle1, 30);
+    var1.reschedule(handle2, 4);
+    var1.reschedule(handle2, 6);
+    EXPECT_EQ(30, var1.deadline_of(handle1));
+
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 5));
+    EXPECT_EQ((std::vector<int>{2}), advance(var1, 6));
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 29));
+    // Handles survive moves between levels
+    var1.at(handle1) = 10;
+    EXPECT_EQ((std::vector<int>{10}), advance(var1, 30));
+}
+
+TEST(FixedTimingWheel, ScheduleAndCancelFromCallback)
+{
+    SmallTimingWheel var1{};
+    var1.schedule(1, 1);
+    const GenerationalIndex handle = var1.schedule(3, 3);
+    std::vector<int> fired{};
+    var1.for_each_expired(10,
+                          [&](const int payload)
+                          {
+                              fired.push_back(payload);
+                              if (payload == 1)
+                              {
+                                  var1.cancel(handle);
+                                  // Due now, fires within the same call
+                                  var1.schedule(0, 100);
+                                  var1.schedule(var1.now() + 5, 5);
+                              }
+                          });
+    EXPECT_EQ((std::vector<int>{1, 100, 5}), fired);
+    EXPECT_TRUE(var1.empty());
+}
+
+TEST(FixedTimingWheel, ScheduleExceedsCapacity)
+{
+    FixedTimingWheel<int, 2> var1{};
+    var1.schedule(1, 1);
+    var1.schedule(1, 2);
+    EXPECT_TRUE(is_full(var1));
+    EXPECT_DEATH(var1.schedule(1, 3), "");
+}
+
+TEST(FixedTimingWheel, Clear)
+{
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle1 = var1.schedule(1, 1);
+    var1.schedule(30, 2);
+    var1.schedule(300, 3);
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_FALSE(var1.contains(handle1));
+    EXPECT_EQ((std::vector<int>{}), advance(var1, 1000));
+
+    var1.schedule(1001, 4);
+    EXPECT_EQ((std::vector<int>{4}), advance(var1, 1001));
+}
+
+TEST(FixedTimingWheel, Copy)
+{
+    SmallTimingWheel var1{};
+    const GenerationalIndex handle1 = var1.schedule(10, 1);
+    var1.schedule(20, 2);
+    SmallTimingWheel var2{var1};
+    EXPECT_EQ(1, var2.at(handle1));
+    var2.cancel(handle1);
+    EXPECT_EQ((std::vector<int>{1, 2}), advance(var1, 20));
+    EXPECT_EQ((std::vector<int>{2}), advance(var2, 20));
+}
+
+TEST(FixedTimingWheel, RandomOperations)
+{
+    // Checked against a list of the pending timers
+    struct Pending
+    {
+        GenerationalIndex handle;
+        std::uint64_t deadline;
+        // The tick it must fire at
+        std::uint64_t due;
+    };
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> random{0, 1000};
+    SmallTimingWheel var1{};
+    std::vector<Pending> pending{};
+    std::vector<std::uint64_t> due_by_payload{};
+
+    // Mostly in range, sometimes beyond, and sometimes already due
+    const auto random_deadline = [&]()
+    { return var1.now() + static_cast<std::uint64_t>(random(generator) % 80); };
+    const auto due_of = [&](const std::uint64_t deadline)
+    { return (std::max)(deadline, var1.now() + 1); };
+
+    for (int step = 0; step < 5000; step++)
+    {
+        const int operation = random(generator) % 4;
+        if (operation == 0 && !is_full(var1))
+        {
+            const std::uint64_t deadline = random_deadline();
+            const GenerationalIndex handle =
+                var1.schedule(deadline, static_cast<int>(due_by_payload.size()));
+            pending.push_back({handle, deadline, due_of(deadline)});
+            due_by_payload.push_back(due_of(deadline));
+        }
+        else if (operation == 1 && !pending.empty())
+        {
+            const auto it = std::next(pending.begin(), random(generator) % std::ssize(pending));
+            EXPECT_EQ(1, var1.cancel(it->handle));
+            pending.erase(it);
+        }
+        else if (operation == 2 && !pending.empty())
+        {
+            const auto it = std::next(pending.begin(), random(generator) % std::ssize(pending));
+            it->deadline = random_deadline();
+            it->due = due_of(it->deadline);
+            var1.reschedule(it->handle, it->deadline);
+            due_by_payload.at(static_cast<std::size_t>(var1.at(it->handle))) = it->due;
+        }
+        else
+        {
+            const std::uint64_t now =
+                var1.now() + static_cast<std::uint64_t>(random(generator) % 8);
+            var1.for_each_expired(
+                now,
+                [&](const int payload)
+                {
+                    // The tick being processed
+                    EXPECT_EQ(due_by_payload.at(static_cast<std::size_t>(payload)),
+                              var1.now() + 1);
+                });
+            std::erase_if(pending, [&](const Pending& entry) { return entry.due <= now; });
+            for (const Pending& entry : pending)
+            {
+                ASSERT_TRUE(var1.contains(entry.handle));
+                ASSERT_EQ(entry.deadline, var1.deadline_of(entry.handle));
+            }
+        }
+        ASSERT_EQ(pending.size(), var1.size());
+    }
+}
+
+TEST(FixedTimingWheel, InstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedTimingWheel<InstanceCounterType, 8, 2, 4> var1{};
+        const GenerationalIndex handle1 = var1.schedule(1, InstanceCounterType{1});
+        var1.schedule(30, InstanceCounterType{2});
+        var1.schedule(40, InstanceCounterType{3});
+        EXPECT_EQ(3, InstanceCounterType::counter);
+        var1.cancel(handle1);
+        EXPECT_EQ(2, InstanceCounterType::counter);
+        var1.for_each_expired(30, [](InstanceCounterType& /*payload*/) {});
+        EXPECT_EQ(1, InstanceCounterType::counter);
+    }
+    // The pending timers are destroyed along with the wheel
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+}  // namespace fixed_containers
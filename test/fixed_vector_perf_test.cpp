@@ -0,0 +1,226 @@
+#include "fixed_containers/fixed_deque.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t ELEMENT_COUNT = 1000;
+constexpr std::size_t CAP = 1024;
+
+using TrivialPayload = std::array<int, 8>;
+
+template <typename SequenceType>
+void benchmark_insert_and_erase_in_the_middle(benchmark::State& state)
+{
+    using ValueType = typename SequenceType::value_type;
+    SequenceType instance{};
+    for (std::size_t i = 0; i < ELEMENT_COUNT; i++)
+    {
+        instance.push_back(ValueType{});
+    }
+
+    for (auto _ : state)
+    {
+        const auto middle = std::next(instance.begin(), ELEMENT_COUNT / 2);
+        auto inserted = instance.insert(middle, ValueType{});
+        benchmark::DoNotOptimize(inserted);
+        auto after_erased = instance.erase(inserted);
+        benchmark::DoNotOptimize(after_erased);
+    }
+}
+
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<std::vector<int>>);
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<FixedVector<int, CAP>>);
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<std::deque<int>>);
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<FixedDeque<int, CAP>>);
+
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<std::vector<TrivialPayload>>);
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<FixedVector<TrivialPayload, CAP>>);
+
+// Not trivially relocatable: element-wise move-construct + destroy
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<std::vector<std::string>>);
+BENCHMARK(benchmark_insert_and_erase_in_the_middle<FixedVector<std::string, CAP>>);
+
+constexpr std::int64_t SEARCH_CAP = 4096;
+
+template <typename SequenceType>
+SequenceType make_search_instance(const std::int64_t size)
+{
+    using ValueType = typename SequenceType::value_type;
+    SequenceType instance{};
+    for (std::int64_t i = 0; i < size; i++)
+    {
+        instance.push_back(static_cast<ValueType>(1));
+    }
+    return instance;
+}
+
+// The value is absent, so every element is compared
+template <typename SequenceType>
+void benchmark_std_find(benchmark::State& state)
+{
+    using ValueType = typename SequenceType::value_type;
+    const auto instance = make_search_instance<SequenceType>(state.range(0));
+    for (auto _ : state)
+    {
+        auto found = std::find(instance.begin(), instance.end(), static_cast<ValueType>(7));
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename SequenceType>
+void benchmark_member_find(benchmark::State& state)
+{
+    using ValueType = typename SequenceType::value_type;
+    const auto instance = make_search_instance<SequenceType>(state.range(0));
+    for (auto _ : state)
+    {
+        auto found = instance.find(static_cast<ValueType>(7));
+        benchmark::DoNotOptimize(found);
+    }
+}
+
+template <typename SequenceType>
+void benchmark_std_count(benchmark::State& state)
+{
+    using ValueType = typename SequenceType::value_type;
+    const auto instance = make_search_instance<SequenceType>(state.range(0));
+    for (auto _ : state)
+    {
+        auto count = std::count(instance.begin(), instance.end(), static_cast<ValueType>(1));
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+template <typename SequenceType>
+void benchmark_member_count(benchmark::State& state)
+{
+    using ValueType = typename SequenceType::value_type;
+    const auto instance = make_search_instance<SequenceType>(state.range(0));
+    for (auto _ : state)
+    {
+        auto count = instance.count(static_cast<ValueType>(1));
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+BENCHMARK(benchmark_std_find<std::vector<std::uint32_t>>)->RangeMultiplier(4)->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_std_find<FixedVector<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_find<FixedVector<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_std_find<FixedDeque<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_find<FixedDeque<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+
+BENCHMARK(benchmark_std_find<FixedVector<std::uint8_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_find<FixedVector<std::uint8_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+
+BENCHMARK(benchmark_std_count<FixedVector<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_count<FixedVector<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_std_count<FixedDeque<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_count<FixedDeque<std::uint32_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_std_count<FixedVector<std::uint8_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+BENCHMARK(benchmark_member_count<FixedVector<std::uint8_t, SEARCH_CAP>>)
+    ->RangeMultiplier(4)
+    ->Range(8, SEARCH_CAP);
+
+// The deques are filled from both ends so that their contents wrap around the end of the array
+template <typename SequenceType>
+SequenceType make_indexing_instance()
+{
+    SequenceType instance{};
+    for (std::size_t i = 0; i < ELEMENT_COUNT / 2; i++)
+    {
+        if constexpr (requires { instance.push_front(0); })
+        {
+            instance.push_front(static_cast<int>(i));
+        }
+        else
+        {
+            instance.push_back(static_cast<int>(i));
+        }
+        instance.push_back(static_cast<int>(i));
+    }
+    return instance;
+}
+
+template <typename SequenceType>
+void benchmark_iterate(benchmark::State& state)
+{
+    const auto instance = make_indexing_instance<SequenceType>();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (const int& entry : instance)
+        {
+            sum += entry;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template <typename SequenceType>
+void benchmark_subscript(benchmark::State& state)
+{
+    const auto instance = make_indexing_instance<SequenceType>();
+    for (auto _ : state)
+    {
+        int sum = 0;
+        for (std::size_t i = 0; i < instance.size(); i++)
+        {
+            sum += instance[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Power-of-two capacities wrap indices with a mask, other capacities with a conditional subtract
+constexpr std::size_t NON_POWER_OF_TWO_CAP = 1000;
+
+BENCHMARK(benchmark_iterate<std::vector<int>>);
+BENCHMARK(benchmark_iterate<FixedVector<int, CAP>>);
+BENCHMARK(benchmark_iterate<std::deque<int>>);
+BENCHMARK(benchmark_iterate<FixedDeque<int, CAP>>);
+BENCHMARK(benchmark_iterate<FixedDeque<int, NON_POWER_OF_TWO_CAP>>);
+
+BENCHMARK(benchmark_subscript<std::vector<int>>);
+BENCHMARK(benchmark_subscript<FixedVector<int, CAP>>);
+BENCHMARK(benchmark_subscript<std::deque<int>>);
+BENCHMARK(benchmark_subscript<FixedDeque<int, CAP>>);
+BENCHMARK(benchmark_subscript<FixedDeque<int, NON_POWER_OF_TWO_CAP>>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
@@ -6,6 +6,7 @@
 
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -14,7 +15,10 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <list>
 #include <memory>
 #include <ranges>
 #include <span>
@@ -64,6 +68,12 @@ static_assert(std::is_same_v<int, typename ConstVecType::iterator::value_type>);
 static_assert(std::is_same_v<int, typename ConstVecType::const_iterator::value_type>);
 }  // namespace trivially_copyable_vector
 
+// The size is stored in the narrowest integer that can hold the capacity
+static_assert(consteval_compare::equal<16, sizeof(FixedVector<std::uint8_t, 15>)>);
+static_assert(consteval_compare::equal<44, sizeof(FixedVector<int, 10>)>);
+static_assert(consteval_compare::equal<1204, sizeof(FixedVector<int, 300>)>);
+static_assert(consteval_compare::equal<48, sizeof(FixedVector<std::size_t, 5>)>);
+
 namespace trivially_copyable_but_not_copyable_or_moveable_vector
 {
 using VecType = FixedVector<MockTriviallyCopyableButNotCopyableOrMoveable, 5>;
@@ -1212,6 +1222,102 @@ TEST(FixedVector, ResizeExceedsCapacity)
     EXPECT_DEATH(var1.resize(to_size, 5), "");
 }
 
+namespace
+{
+template <typename VectorType>
+concept SupportsResizeForOverwrite = requires(VectorType var) {
+    var.resize_for_overwrite(1);
+    var.append_uninitialized(1);
+};
+}  // namespace
+
+TEST(FixedVector, ResizeForOverwrite)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 1, 2};
+        var.resize_for_overwrite(5);
+        return var;
+    }();
+    // New elements are value-initialized during constant evaluation
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 0, 0}));
+
+    FixedVector<int, 7> var1{0, 1, 2};
+    var1.resize_for_overwrite(6);
+    EXPECT_EQ(6, var1.size());
+    const std::array<int, 3> tail{3, 4, 5};
+    std::memcpy(std::next(var1.data(), 3), tail.data(), sizeof(tail));
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{0, 1, 2, 3, 4, 5}));
+
+    var1.resize_for_overwrite(2);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{0, 1}));
+
+    static_assert(SupportsResizeForOverwrite<FixedVector<int, 5>>);
+    static_assert(!SupportsResizeForOverwrite<FixedVector<MockNonTrivialInt, 5>>);
+}
+
+TEST(FixedVector, ResizeForOverwriteExceedsCapacity)
+{
+    FixedVector<int, 3> var1{};
+    EXPECT_DEATH(var1.resize_for_overwrite(6), "");
+    EXPECT_DEATH(var1.append_uninitialized(4), "");
+}
+
+TEST(FixedVector, AppendUninitialized)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 1};
+        int* const appended = var.append_uninitialized(2);
+        *std::next(appended) = 3;
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 0, 3}));
+
+    FixedVector<int, 7> var1{0, 1};
+    int* const appended = var1.append_uninitialized(3);
+    EXPECT_EQ(std::next(var1.data(), 2), appended);
+    EXPECT_EQ(5, var1.size());
+    std::fill_n(appended, 3, 9);
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{0, 1, 9, 9, 9}));
+}
+
+TEST(FixedVector, AppendRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0};
+        var.append_range(std::array{1, 2});
+        var.append_range(std::views::iota(3, 5));
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3, 4}));
+
+    FixedVector<int, 8> var1{0};
+    // Contiguous and trivially copyable: single memcpy
+    const std::array<int, 3> contiguous{1, 2, 3};
+    var1.append_range(contiguous);
+    var1.append_range(std::vector<int>{4, 5});
+    // Not contiguous
+    const std::list<int> not_contiguous{6, 7};
+    var1.append_range(not_contiguous);
+    var1.append_range(std::array<int, 0>{});
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{0, 1, 2, 3, 4, 5, 6, 7}));
+
+    // Not trivially copyable
+    FixedVector<MockNonTrivialInt, 5> var2{};
+    var2.append_range(std::array{MockNonTrivialInt{1}, MockNonTrivialInt{2}});
+    EXPECT_EQ(2, var2.size());
+    EXPECT_EQ(2, var2.back().value);
+}
+
+TEST(FixedVector, AppendRangeExceedsCapacity)
+{
+    FixedVector<int, 3> var1{0, 1};
+    EXPECT_DEATH(var1.append_range(std::array{2, 3}), "");
+    EXPECT_DEATH(var1.append_range(std::list<int>{2, 3}), "");
+}
+
 TEST(FixedVector, Size)
 {
     {
@@ -1608,6 +1714,63 @@ TEST(FixedVector, InsertInputIteratorExceedsCapacity)
     EXPECT_DEATH(var.insert(std::next(var.begin(), 2), stream.begin(), stream.end()), "");
 }
 
+TEST(FixedVector, InsertSizedInputIterator)
+{
+    // Single-pass, but the distance is known up front
+    MockIntegralStream<int> stream{3};
+    std::counted_iterator first{stream.begin(), 3};
+    std::counted_iterator last{stream.end(), 0};
+    static_assert(std::sized_sentinel_for<decltype(last), decltype(first)>);
+
+    FixedVector<int, 7> var{10, 20, 30, 40};
+    auto iter = var.insert(std::next(var.begin(), 2), first, last);
+    EXPECT_TRUE(std::ranges::equal(var, std::array{10, 20, 3, 2, 1, 30, 40}));
+    EXPECT_EQ(iter, std::next(var.begin(), 2));
+}
+
+TEST(FixedVector, InsertRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 7> var{0, 5};
+        var.insert_range(std::next(var.cbegin()), std::array{1, 2});
+        var.insert_range(std::next(var.cbegin(), 3), std::views::iota(3, 5));
+        var.insert_range(var.cend(), std::array<int, 0>{});
+        return var;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{0, 1, 2, 3, 4, 5}));
+
+    FixedVector<int, 10> var1{0, 9};
+    // Contiguous and trivially copyable: single memcpy
+    auto iter = var1.insert_range(std::next(var1.cbegin()), std::vector<int>{1, 2, 3});
+    EXPECT_EQ(iter, std::next(var1.begin()));
+    // Forward, not sized
+    const std::list<int> not_contiguous{4, 5};
+    var1.insert_range(std::next(var1.cbegin(), 4), not_contiguous);
+    // Single-pass, not sized
+    MockIntegralStream<int> stream{3};
+    iter = var1.insert_range(std::next(var1.cbegin(), 6), stream);
+    EXPECT_EQ(iter, std::next(var1.begin(), 6));
+    EXPECT_TRUE(std::ranges::equal(var1, std::array{0, 1, 2, 3, 4, 5, 3, 2, 1, 9}));
+
+    // Not trivially copyable
+    FixedVector<MockNonTrivialInt, 5> var2{MockNonTrivialInt{0}, MockNonTrivialInt{3}};
+    var2.insert_range(std::next(var2.cbegin()),
+                      std::array{MockNonTrivialInt{1}, MockNonTrivialInt{2}});
+    EXPECT_EQ(4, var2.size());
+    EXPECT_EQ(2, var2[2].value);
+    EXPECT_EQ(3, var2.back().value);
+}
+
+TEST(FixedVector, InsertRangeExceedsCapacity)
+{
+    FixedVector<int, 3> var1{0, 1};
+    EXPECT_DEATH(var1.insert_range(var1.cbegin(), std::array{2, 3}), "");
+    EXPECT_DEATH(var1.insert_range(var1.cbegin(), std::list<int>{2, 3}), "");
+    MockIntegralStream<int> stream{2};
+    EXPECT_DEATH(var1.insert_range(var1.cbegin(), stream), "");
+}
+
 TEST(FixedVector, InsertInitializerList)
 {
     {
@@ -1713,6 +1876,28 @@ TEST(FixedVector, EraseOne)
     }
 }
 
+TEST(FixedVector, InsertAndEraseTriviallyRelocatable)
+{
+    MockTriviallyRelocatableInt::move_construction_counter = 0;
+    FixedVector<MockTriviallyRelocatableInt, 8> var{};
+    for (int i = 0; i < 5; i++)
+    {
+        var.emplace_back(i);
+    }
+
+    var.insert(std::next(var.cbegin(), 2), {10, 11});
+    EXPECT_TRUE(std::ranges::equal(
+        var, std::array<MockTriviallyRelocatableInt, 7>{0, 1, 10, 11, 2, 3, 4}));
+    var.erase(std::next(var.cbegin(), 1), std::next(var.cbegin(), 3));
+    EXPECT_TRUE(
+        std::ranges::equal(var, std::array<MockTriviallyRelocatableInt, 5>{0, 11, 2, 3, 4}));
+    var.erase(var.cbegin());
+    EXPECT_TRUE(std::ranges::equal(var, std::array<MockTriviallyRelocatableInt, 4>{11, 2, 3, 4}));
+
+    // Shifting is done with memmove instead of move-construction
+    EXPECT_EQ(0, MockTriviallyRelocatableInt::move_construction_counter);
+}
+
 TEST(FixedVector, EraseEmpty)
 {
     {
@@ -1777,6 +1962,97 @@ TEST(FixedVector, EraseIf)
     static_assert(std::ranges::equal(VAL1, std::array<int, 3>{1, 3, 5}));
 }
 
+TEST(FixedVector, EraseUnordered)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2, 3, 4};
+        auto it = var.erase_unordered(std::next(var.cbegin()));
+        assert_or_abort(*it == 4);
+        it = var.erase_unordered(std::prev(var.cend()));
+        assert_or_abort(it == var.end());
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array<int, 3>{0, 4, 2}));
+
+    FixedVector<MockNonTrivialInt, 8> var{0, 1, 2, 3};
+    auto it = var.erase_unordered(var.cbegin());
+    EXPECT_EQ(3, it->value);
+    EXPECT_TRUE(std::ranges::equal(
+        var, std::array<int, 3>{3, 1, 2}, {}, [](const auto& entry) { return entry.value; }));
+
+    EXPECT_DEATH(var.erase_unordered(var.cend()), "");
+}
+
+TEST(FixedVector, EraseUnorderedTriviallyRelocatable)
+{
+    MockTriviallyRelocatableInt::move_construction_counter = 0;
+    FixedVector<MockTriviallyRelocatableInt, 8> var{};
+    for (int i = 0; i < 5; i++)
+    {
+        var.emplace_back(i);
+    }
+    var.erase_unordered(std::next(var.cbegin(), 1));
+    var.erase_unordered(std::prev(var.cend()));
+    EXPECT_TRUE(std::ranges::equal(var, std::array<MockTriviallyRelocatableInt, 3>{0, 4, 2}));
+    EXPECT_EQ(0, MockTriviallyRelocatableInt::move_construction_counter);
+}
+
+TEST(FixedVector, EraseUnorderedInstanceCounter)
+{
+    using InstanceCounterType = instance_counter::InstanceCounterNonTrivialAssignment<int>;
+    InstanceCounterType::counter = 0;
+    {
+        FixedVector<InstanceCounterType, 8> var{};
+        for (int i = 0; i < 5; i++)
+        {
+            var.emplace_back(i);
+        }
+        EXPECT_EQ(5, InstanceCounterType::counter);
+        var.erase_unordered(var.cbegin());
+        EXPECT_EQ(4, InstanceCounterType::counter);
+        var.erase_unordered_if([](const InstanceCounterType& entry) { return entry.get() < 3; });
+        EXPECT_EQ(2, InstanceCounterType::counter);
+    }
+    EXPECT_EQ(0, InstanceCounterType::counter);
+}
+
+TEST(FixedVector, EraseUnorderedIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2, 3, 4, 5, 6};
+        const std::size_t removed_count = fixed_containers::erase_unordered_if(
+            var, [](const int& entry) { return (entry % 2) == 0; });
+        assert_or_abort(4 == removed_count);
+        return var;
+    }();
+
+    // Holes are filled from the back
+    static_assert(std::ranges::equal(VAL1, std::array<int, 3>{5, 1, 3}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedVector<int, 8> var{0, 1, 2, 3, 4, 5, 6};
+        var.erase_unordered_if([](const int& entry) { return entry < 2; });
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL2, std::array<int, 5>{6, 5, 2, 3, 4}));
+
+    FixedVector<int, 8> var{1, 2, 3};
+    EXPECT_EQ(0, erase_unordered_if(var, [](const int& entry) { return entry > 5; }));
+    EXPECT_EQ(3, erase_unordered_if(var, [](const int& entry) { return entry > 0; }));
+    EXPECT_TRUE(var.empty());
+    EXPECT_EQ(0, erase_unordered_if(var, [](const int& entry) { return entry > 0; }));
+
+    // Trailing removed elements are simply dropped
+    var = {1, 2, 3, 4};
+    EXPECT_EQ(2, erase_unordered_if(var, [](const int& entry) { return entry >= 3; }));
+    EXPECT_TRUE(std::ranges::equal(var, std::array<int, 2>{1, 2}));
+}
+
 TEST(FixedVector, Front)
 {
     constexpr auto VAL1 = []()
@@ -1874,6 +2150,57 @@ TEST(FixedVector, Data)
     }
 }
 
+TEST(FixedVector, FindCountContains)
+{
+    constexpr FixedVector<int, 8> VAL1{3, 1, 3, 2};
+    static_assert(VAL1.find(3) == VAL1.cbegin());
+    static_assert(VAL1.find(2) == std::next(VAL1.cbegin(), 3));
+    static_assert(VAL1.find(7) == VAL1.cend());
+    static_assert(VAL1.count(3) == 2);
+    static_assert(VAL1.count(7) == 0);
+    static_assert(VAL1.contains(1));
+    static_assert(!VAL1.contains(7));
+
+    // Long enough to span several blocks, with matches in a block and in the tail
+    FixedVector<std::uint8_t, 200> var1(150, 1);
+    EXPECT_EQ(var1.end(), var1.find(7));
+    EXPECT_EQ(0, var1.count(7));
+    var1[70] = 7;
+    var1[71] = 7;
+    var1[149] = 7;
+    EXPECT_EQ(std::next(var1.begin(), 70), var1.find(7));
+    EXPECT_EQ(3, var1.count(7));
+    EXPECT_EQ(147, var1.count(1));
+    EXPECT_TRUE(var1.contains(7));
+    *var1.find(7) = 8;
+    EXPECT_EQ(std::next(var1.cbegin(), 71), std::as_const(var1).find(7));
+
+    FixedVector<float, 50> var2(40, 0.5F);
+    var2[39] = -0.0F;
+    EXPECT_EQ(std::next(var2.begin(), 39), var2.find(0.0F));
+    EXPECT_EQ(39, var2.count(0.5F));
+
+    enum class Color : std::uint16_t
+    {
+        RED,
+        GREEN,
+    };
+    FixedVector<Color, 100> var3(90, Color::RED);
+    var3.back() = Color::GREEN;
+    EXPECT_EQ(std::prev(var3.end()), var3.find(Color::GREEN));
+    EXPECT_EQ(89, var3.count(Color::RED));
+
+    // Not block comparable
+    FixedVector<std::uint64_t, 100> var4(90, 1);
+    var4[80] = 2;
+    EXPECT_EQ(std::next(var4.begin(), 80), var4.find(2));
+    EXPECT_EQ(89, var4.count(1));
+
+    const FixedVector<int, 8> var5{};
+    EXPECT_EQ(var5.end(), var5.find(0));
+    EXPECT_EQ(0, var5.count(0));
+}
+
 TEST(FixedVector, Ranges)
 {
 #if !defined(__clang__) || __clang_major__ >= 16
@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace fixed_containers
 {
@@ -40,4 +43,20 @@ TEST(IntMath, Add)
     static_assert(6ULL == int_math::safe_add(15ULL, -9).cast<std::size_t>());
 }
 
+TEST(IntMath, SmallestUnsignedIntegralFor)
+{
+    static_assert(std::same_as<std::uint8_t, int_math::SmallestUnsignedIntegralFor<0>>);
+    static_assert(std::same_as<std::uint8_t, int_math::SmallestUnsignedIntegralFor<255>>);
+    static_assert(std::same_as<std::uint16_t, int_math::SmallestUnsignedIntegralFor<256>>);
+    static_assert(std::same_as<std::uint16_t, int_math::SmallestUnsignedIntegralFor<65535>>);
+    static_assert(std::same_as<std::uint32_t, int_math::SmallestUnsignedIntegralFor<65536>>);
+    static_assert(std::same_as<std::uint32_t, int_math::SmallestUnsignedIntegralFor<4294967295>>);
+    static_assert(std::same_as<std::size_t, int_math::SmallestUnsignedIntegralFor<4294967296>>);
+
+    static_assert(1 == int_math::smallest_unsigned_integral_size_bytes_for(255));
+    static_assert(2 == int_math::smallest_unsigned_integral_size_bytes_for(256));
+    static_assert(4 == int_math::smallest_unsigned_integral_size_bytes_for(65536));
+    static_assert(8 == int_math::smallest_unsigned_integral_size_bytes_for(4294967296));
+}
+
 }  // namespace fixed_containers
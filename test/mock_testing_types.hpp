@@ -430,6 +430,48 @@ public:
 static_assert(alignof(MockAligned64) == 64);
 static_assert(sizeof(MockAligned64) == 64);
 
+// Not trivially copyable, but opts into trivial relocation. Counts move-constructions, so tests
+// can verify that containers shift it with memmove instead.
+struct MockTriviallyRelocatableInt
+{
+    static inline std::size_t move_construction_counter = 0;
+
+    int value = 0;
+
+    explicit(false) MockTriviallyRelocatableInt(int val)
+      : value{val}
+    {
+    }
+
+    MockTriviallyRelocatableInt(const MockTriviallyRelocatableInt& other) noexcept = default;
+    MockTriviallyRelocatableInt(MockTriviallyRelocatableInt&& other) noexcept
+      : value{other.value}
+    {
+        move_construction_counter++;
+    }
+
+    MockTriviallyRelocatableInt& operator=(const MockTriviallyRelocatableInt& other) noexcept =
+        default;
+    MockTriviallyRelocatableInt& operator=(MockTriviallyRelocatableInt&& other) noexcept = default;
+
+    ~MockTriviallyRelocatableInt() {}  // NOLINT(modernize-use-equals-default)
+
+    constexpr bool operator==(const MockTriviallyRelocatableInt& other) const = default;
+};
+
+}  // namespace fixed_containers
+
+template <>
+struct fixed_containers::customize::IsTriviallyRelocatable<
+    fixed_containers::MockTriviallyRelocatableInt> : std::true_type
+{
+};
+
+namespace fixed_containers
+{
+static_assert(NotTriviallyCopyable<MockTriviallyRelocatableInt>);
+static_assert(TriviallyRelocatable<MockTriviallyRelocatableInt>);
+static_assert(NotTriviallyRelocatable<MockNonTrivialInt>);
 }  // namespace fixed_containers
 
 template <>